@@ -9,6 +9,6 @@ public class NicksExampleProjectTarget : TargetRules
 	{
 		Type = TargetType.Game;
 		DefaultBuildSettings = BuildSettingsVersion.V2;
-		ExtraModuleNames.Add("NicksExampleProject");
+		ExtraModuleNames.AddRange( new string[] { "NicksExampleProject", "NicksExampleProjectUI" } );
 	}
 }
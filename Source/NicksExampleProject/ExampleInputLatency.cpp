@@ -0,0 +1,137 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleInputLatency.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GExampleInputLatencyEnable = 0;
+static FAutoConsoleVariableRef CVarExampleInputLatencyEnable(
+	TEXT("ExampleUI.InputLatency.Enable"),
+	GExampleInputLatencyEnable,
+	TEXT("Stamps input events and measures the time until the resulting widget change is painted."));
+
+static float GExampleInputLatencyTimeoutMs = 500.0f;
+static FAutoConsoleVariableRef CVarExampleInputLatencyTimeoutMs(
+	TEXT("ExampleUI.InputLatency.TimeoutMs"),
+	GExampleInputLatencyTimeoutMs,
+	TEXT("Pending input stamps older than this are thrown away, so input that never changed anything doesn't get blamed on a later change."));
+
+static FAutoConsoleCommandWithOutputDevice ExampleInputLatencyDumpCommand(
+	TEXT("ExampleUI.InputLatency.Dump"),
+	TEXT("Prints the input to paint latency histogram."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FExampleInputLatencyTracker::Dump));
+
+static FAutoConsoleCommand ExampleInputLatencyResetCommand(
+	TEXT("ExampleUI.InputLatency.Reset"),
+	TEXT("Clears the input to paint latency histogram."),
+	FConsoleCommandDelegate::CreateStatic(&FExampleInputLatencyTracker::Reset));
+
+const double FExampleInputLatencyTracker::BucketUpperBoundsMs[NumBuckets] = { 1.0, 2.0, 4.0, 8.0, 16.7, 33.3, 50.0, 66.7, 100.0, 150.0, 250.0, DBL_MAX };
+
+uint64 FExampleInputLatencyTracker::PendingStamp = 0;
+uint64 FExampleInputLatencyTracker::LastRecordedStamp = 0;
+uint32 FExampleInputLatencyTracker::Buckets[NumBuckets] = {};
+uint32 FExampleInputLatencyTracker::SampleCount = 0;
+double FExampleInputLatencyTracker::TotalMs = 0.0;
+double FExampleInputLatencyTracker::MinMs = DBL_MAX;
+double FExampleInputLatencyTracker::MaxMs = 0.0;
+
+bool FExampleInputLatencyTracker::IsEnabled()
+{
+	return GExampleInputLatencyEnable != 0;
+}
+
+void FExampleInputLatencyTracker::StampInput()
+{
+	// Always the latest input, under constant input(like the mouse moving) an older one would have nothing to do
+	// with whatever changes next and would just make it look slower than it is
+	if (IsEnabled())
+	{
+		PendingStamp = FPlatformTime::Cycles64();
+	}
+}
+
+uint64 FExampleInputLatencyTracker::GetPendingStamp()
+{
+	if (!IsEnabled() || PendingStamp == 0)
+	{
+		return 0;
+	}
+
+	// Throw the stamp away if its been around for too long
+	const double AgeMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PendingStamp);
+	if (AgeMs > GExampleInputLatencyTimeoutMs)
+	{
+		PendingStamp = 0;
+	}
+
+	return PendingStamp;
+}
+
+void FExampleInputLatencyTracker::RecordPaint(uint64 InputStamp)
+{
+	// An input only gets measured by the first paint it made it to, the rest of the widgets it changed don't add samples
+	if (!IsEnabled() || InputStamp == 0 || InputStamp <= LastRecordedStamp)
+	{
+		return;
+	}
+	LastRecordedStamp = InputStamp;
+
+	const double LatencyMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - InputStamp);
+
+	// Find the bucket this sample lands in
+	int32 BucketIndex = 0;
+	while (LatencyMs > BucketUpperBoundsMs[BucketIndex] && BucketIndex < NumBuckets - 1)
+	{
+		++BucketIndex;
+	}
+
+	++Buckets[BucketIndex];
+	++SampleCount;
+	TotalMs += LatencyMs;
+	MinMs = FMath::Min(MinMs, LatencyMs);
+	MaxMs = FMath::Max(MaxMs, LatencyMs);
+
+	// The input that was pending has now been painted, so the next input starts a new measurement
+	if (PendingStamp != 0 && PendingStamp <= InputStamp)
+	{
+		PendingStamp = 0;
+	}
+}
+
+void FExampleInputLatencyTracker::Dump(FOutputDevice& Ar)
+{
+	if (SampleCount == 0)
+	{
+		Ar.Logf(TEXT("No input latency samples recorded (is ExampleUI.InputLatency.Enable set?)."));
+		return;
+	}
+
+	Ar.Logf(TEXT("Input to paint latency: %u samples, avg %.2fms, min %.2fms, max %.2fms"), SampleCount, TotalMs / SampleCount, MinMs, MaxMs);
+
+	double LowerBoundMs = 0.0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		const float Percent = 100.0f * Buckets[BucketIndex] / SampleCount;
+		if (BucketIndex < NumBuckets - 1)
+		{
+			Ar.Logf(TEXT("  %6.1f - %6.1fms: %6u (%5.1f%%)"), LowerBoundMs, BucketUpperBoundsMs[BucketIndex], Buckets[BucketIndex], Percent);
+		}
+		else
+		{
+			Ar.Logf(TEXT("  %6.1fms +       : %6u (%5.1f%%)"), LowerBoundMs, Buckets[BucketIndex], Percent);
+		}
+		LowerBoundMs = BucketUpperBoundsMs[BucketIndex];
+	}
+}
+
+void FExampleInputLatencyTracker::Reset()
+{
+	PendingStamp = 0;
+	LastRecordedStamp = 0;
+	FMemory::Memzero(Buckets);
+	SampleCount = 0;
+	TotalMs = 0.0;
+	MinMs = DBL_MAX;
+	MaxMs = 0.0;
+}
@@ -0,0 +1,60 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Measures how long it takes from an input arriving to the visual change it caused being painted.
+ *
+ * Input handlers call StampInput(), widgets grab the pending stamp when one of their properties is set
+ * and hand it back through RecordPaint() the next time they paint. Each input only gets measured once, by the first paint
+ * it's handed back from, after that it's no longer pending so later unrelated changes don't get blamed on it. The results end up in a latency histogram
+ * which can be dumped with "ExampleUI.InputLatency.Dump" and cleared with "ExampleUI.InputLatency.Reset".
+ *
+ * Everything here is a no-op unless "ExampleUI.InputLatency.Enable" is set, and it's game thread only.
+ */
+class NICKSEXAMPLEPROJECT_API FExampleInputLatencyTracker
+{
+public:
+
+	/** Whether or not latency tracking is turned on */
+	static bool IsEnabled();
+
+	/** Stamps an input as having arrived right now, replacing any input that hasn't been painted yet */
+	static void StampInput();
+
+	/** Returns the latest input stamp that hasn't been painted yet, or 0 if there isn't one (or it timed out) */
+	static uint64 GetPendingStamp();
+
+	/**
+	 * Records the latency between the input stamp and now, called when a stamped change gets painted.
+	 * Only the first paint for an input counts, so one input changing a bunch of widgets is still just the one sample
+	 */
+	static void RecordPaint(uint64 InputStamp);
+
+	/** Prints the latency histogram */
+	static void Dump(FOutputDevice& Ar);
+
+	/** Clears the histogram and any pending input */
+	static void Reset();
+
+private:
+
+	static constexpr int32 NumBuckets = 12;
+
+	/** Upper bounds(in milliseconds) of each histogram bucket, the last bucket catches everything above */
+	static const double BucketUpperBoundsMs[NumBuckets];
+
+	/** The latest input that hasn't resulted in a paint yet */
+	static uint64 PendingStamp;
+
+	/** The newest input we've recorded a sample for, anything at or before it has already been measured */
+	static uint64 LastRecordedStamp;
+
+	static uint32 Buckets[NumBuckets];
+	static uint32 SampleCount;
+	static double TotalMs;
+	static double MinMs;
+	static double MaxMs;
+};
@@ -8,20 +8,17 @@ public class NicksExampleProject : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
+		// The UI module includes our character and input latency headers
+		PublicIncludePaths.Add(ModuleDirectory);
+
+		// No UMG/Slate here, all of the UI lives in NicksExampleProjectUI so server builds can leave it out
 		PublicDependencyModuleNames.AddRange(new string[]
 		{
 			"Core", 
 			"CoreUObject", 
 			"Engine", 
 			"InputCore", 
-			"HeadMountedDisplay",
-			"UMG"
-		});
-		
-		PrivateDependencyModuleNames.AddRange(new string[]
-		{
-			"Slate",
-			"SlateCore"
+			"HeadMountedDisplay"
 		});
 	}
 }
@@ -8,6 +8,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Controller.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "ExampleInputLatency.h"
 
 //////////////////////////////////////////////////////////////////////////
 // ANicksExampleProjectCharacter
@@ -54,8 +55,8 @@ void ANicksExampleProjectCharacter::SetupPlayerInputComponent(class UInputCompon
 {
 	// Set up gameplay key bindings
 	check(PlayerInputComponent);
-	PlayerInputComponent->BindAction("Jump", IE_Pressed, this, &ACharacter::Jump);
-	PlayerInputComponent->BindAction("Jump", IE_Released, this, &ACharacter::StopJumping);
+	PlayerInputComponent->BindAction("Jump", IE_Pressed, this, &ANicksExampleProjectCharacter::JumpPressed);
+	PlayerInputComponent->BindAction("Jump", IE_Released, this, &ANicksExampleProjectCharacter::JumpReleased);
 
 	PlayerInputComponent->BindAxis("MoveForward", this, &ANicksExampleProjectCharacter::MoveForward);
 	PlayerInputComponent->BindAxis("MoveRight", this, &ANicksExampleProjectCharacter::MoveRight);
@@ -63,9 +64,9 @@ void ANicksExampleProjectCharacter::SetupPlayerInputComponent(class UInputCompon
 	// We have 2 versions of the rotation bindings to handle different kinds of devices differently
 	// "turn" handles devices that provide an absolute delta, such as a mouse.
 	// "turnrate" is for devices that we choose to treat as a rate of change, such as an analog joystick
-	PlayerInputComponent->BindAxis("Turn", this, &APawn::AddControllerYawInput);
+	PlayerInputComponent->BindAxis("Turn", this, &ANicksExampleProjectCharacter::Turn);
 	PlayerInputComponent->BindAxis("TurnRate", this, &ANicksExampleProjectCharacter::TurnAtRate);
-	PlayerInputComponent->BindAxis("LookUp", this, &APawn::AddControllerPitchInput);
+	PlayerInputComponent->BindAxis("LookUp", this, &ANicksExampleProjectCharacter::LookUp);
 	PlayerInputComponent->BindAxis("LookUpRate", this, &ANicksExampleProjectCharacter::LookUpAtRate);
 
 	// handle touch devices
@@ -74,11 +75,16 @@ void ANicksExampleProjectCharacter::SetupPlayerInputComponent(class UInputCompon
 
 	// VR headset functionality
 	PlayerInputComponent->BindAction("ResetVR", IE_Pressed, this, &ANicksExampleProjectCharacter::OnResetVR);
+
+	// Every handler above stamps its input with FExampleInputLatencyTracker (when ExampleUI.InputLatency.Enable is set)
+	// so we can measure how long it takes until a widget paints the change it caused
 }
 
 
 void ANicksExampleProjectCharacter::OnResetVR()
 {
+	FExampleInputLatencyTracker::StampInput();
+
 	// If NicksExampleProject is added to a project via 'Add Feature' in the Unreal Editor the dependency on HeadMountedDisplay in NicksExampleProject.Build.cs is not automatically propagated
 	// and a linker error will result.
 	// You will need to either:
@@ -90,22 +96,65 @@ void ANicksExampleProjectCharacter::OnResetVR()
 
 void ANicksExampleProjectCharacter::TouchStarted(ETouchIndex::Type FingerIndex, FVector Location)
 {
+		FExampleInputLatencyTracker::StampInput();
 		Jump();
 }
 
 void ANicksExampleProjectCharacter::TouchStopped(ETouchIndex::Type FingerIndex, FVector Location)
 {
+		FExampleInputLatencyTracker::StampInput();
 		StopJumping();
 }
 
+void ANicksExampleProjectCharacter::JumpPressed()
+{
+	FExampleInputLatencyTracker::StampInput();
+	Jump();
+}
+
+void ANicksExampleProjectCharacter::JumpReleased()
+{
+	FExampleInputLatencyTracker::StampInput();
+	StopJumping();
+}
+
+void ANicksExampleProjectCharacter::Turn(float Value)
+{
+	// Axis bindings fire every frame, only actual input counts
+	if (Value != 0.0f)
+	{
+		FExampleInputLatencyTracker::StampInput();
+	}
+	AddControllerYawInput(Value);
+}
+
+void ANicksExampleProjectCharacter::LookUp(float Value)
+{
+	if (Value != 0.0f)
+	{
+		FExampleInputLatencyTracker::StampInput();
+	}
+	AddControllerPitchInput(Value);
+}
+
 void ANicksExampleProjectCharacter::TurnAtRate(float Rate)
 {
+	if (Rate != 0.0f)
+	{
+		FExampleInputLatencyTracker::StampInput();
+	}
+
 	// calculate delta for this frame from the rate information
 	AddControllerYawInput(Rate * BaseTurnRate * GetWorld()->GetDeltaSeconds());
 }
 
 void ANicksExampleProjectCharacter::LookUpAtRate(float Rate)
 {
+	if (Rate != 0.0f)
+	{
+		FExampleInputLatencyTracker::StampInput();
+	}
+
 	// calculate delta for this frame from the rate information
 	AddControllerPitchInput(Rate * BaseLookUpRate * GetWorld()->GetDeltaSeconds());
 }
@@ -114,6 +163,8 @@ void ANicksExampleProjectCharacter::MoveForward(float Value)
 {
 	if ((Controller != nullptr) && (Value != 0.0f))
 	{
+		FExampleInputLatencyTracker::StampInput();
+
 		// find out which way is forward
 		const FRotator Rotation = Controller->GetControlRotation();
 		const FRotator YawRotation(0, Rotation.Yaw, 0);
@@ -128,6 +179,8 @@ void ANicksExampleProjectCharacter::MoveRight(float Value)
 {
 	if ( (Controller != nullptr) && (Value != 0.0f) )
 	{
+		FExampleInputLatencyTracker::StampInput();
+
 		// find out which way is right
 		const FRotator Rotation = Controller->GetControlRotation();
 		const FRotator YawRotation(0, Rotation.Yaw, 0);
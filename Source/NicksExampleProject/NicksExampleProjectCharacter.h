@@ -7,7 +7,7 @@
 #include "NicksExampleProjectCharacter.generated.h"
 
 UCLASS(config=Game)
-class ANicksExampleProjectCharacter : public ACharacter
+class NICKSEXAMPLEPROJECT_API ANicksExampleProjectCharacter : public ACharacter
 {
 	GENERATED_BODY()
 
@@ -58,6 +58,14 @@ protected:
 	/** Handler for when a touch input stops. */
 	void TouchStopped(ETouchIndex::Type FingerIndex, FVector Location);
 
+	/** Called for jump input, these just forward to ACharacter so we can stamp the input for latency tracking */
+	void JumpPressed();
+	void JumpReleased();
+
+	/** Called for absolute yaw/pitch input (e.g. a mouse), forwards to APawn so we can stamp the input for latency tracking */
+	void Turn(float Value);
+	void LookUp(float Value);
+
 protected:
 	// APawn interface
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
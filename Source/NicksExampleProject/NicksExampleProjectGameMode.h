@@ -6,8 +6,8 @@
 #include "GameFramework/GameModeBase.h"
 #include "NicksExampleProjectGameMode.generated.h"
 
-UCLASS(minimalapi)
-class ANicksExampleProjectGameMode : public AGameModeBase
+UCLASS()
+class NICKSEXAMPLEPROJECT_API ANicksExampleProjectGameMode : public AGameModeBase
 {
 	GENERATED_BODY()
 
@@ -9,6 +9,6 @@ public class NicksExampleProjectEditorTarget : TargetRules
 	{
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V2;
-		ExtraModuleNames.Add("NicksExampleProject");
+		ExtraModuleNames.AddRange( new string[] { "NicksExampleProject", "NicksExampleProjectUI" } );
 	}
 }
@@ -0,0 +1,16 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+public class NicksExampleProjectServerTarget : TargetRules
+{
+	public NicksExampleProjectServerTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Server;
+		DefaultBuildSettings = BuildSettingsVersion.V2;
+
+		// Just the gameplay module, NicksExampleProjectUI is client only and UMG is never pulled in
+		ExtraModuleNames.Add("NicksExampleProject");
+	}
+}
@@ -0,0 +1,164 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleAllocationCounter.h"
+#include "HAL/MemoryBase.h"
+
+namespace ExampleAllocationCounter
+{
+	/** How many scopes are currently counting */
+	static int32 ActiveScopes = 0;
+
+	/** Running totals, only ever touched from the game thread */
+	static FExampleAllocationCounts Totals;
+
+	static FORCEINLINE void Count(SIZE_T Size)
+	{
+		if (ActiveScopes > 0 && IsInGameThread())
+		{
+			++Totals.Allocations;
+			Totals.Bytes += Size;
+		}
+	}
+
+	/** Sits in front of the real allocator, counts what the game thread asks for and hands everything else straight through */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+
+		explicit FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		FMalloc* GetInnerMalloc() const { return InnerMalloc; }
+
+		//~ Begin FMalloc Interface
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			ExampleAllocationCounter::Count(Count);
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			ExampleAllocationCounter::Count(Count);
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				ExampleAllocationCounter::Count(Count);
+			}
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				ExampleAllocationCounter::Count(Count);
+			}
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+		//~ End FMalloc Interface
+
+	private:
+
+		FMalloc* InnerMalloc;
+	};
+
+	/** The proxy while it's in front of GMalloc. Static storage so the proxy itself never goes through GMalloc */
+	static FCountingMalloc* Proxy = nullptr;
+	static TTypeCompatibleBytes<FCountingMalloc> ProxyStorage;
+
+	static void Install()
+	{
+		check(IsInGameThread());
+
+		// Still in place from last time(see Uninstall), it'll count again now that a scope is active
+		if (Proxy)
+		{
+			return;
+		}
+
+		Proxy = new (ProxyStorage.GetTypedPtr()) FCountingMalloc(GMalloc);
+		FPlatformMisc::MemoryBarrier();
+		GMalloc = Proxy;
+	}
+
+	static void Uninstall()
+	{
+		check(IsInGameThread() && Proxy);
+
+		// The proxy allocates nothing itself, everything it handed out came from the allocator underneath so it can be freed there.
+		// Another thread that grabbed GMalloc just before this still gets forwarded since the proxy's storage never goes away.
+		// If someone else put their own allocator in front of ours meanwhile we can't take ours out from under them, so it stays
+		// (only forwarding while nothing's counting) and gets reused by the next scope
+		if (GMalloc == Proxy)
+		{
+			GMalloc = Proxy->GetInnerMalloc();
+			FPlatformMisc::MemoryBarrier();
+			Proxy = nullptr;
+		}
+		else
+		{
+			UE_LOG(LogMemory, Warning, TEXT("FExampleAllocationScope: GMalloc was replaced while counting, leaving the counting allocator in place"));
+		}
+	}
+}
+
+FExampleAllocationScope::FExampleAllocationScope()
+{
+	// Only the outermost scope swaps the allocator, nested ones just read the totals
+	if (IsSupported() && ExampleAllocationCounter::ActiveScopes == 0)
+	{
+		ExampleAllocationCounter::Install();
+	}
+
+	StartCounts = ExampleAllocationCounter::Totals;
+	++ExampleAllocationCounter::ActiveScopes;
+}
+
+FExampleAllocationScope::~FExampleAllocationScope()
+{
+	--ExampleAllocationCounter::ActiveScopes;
+	if (IsSupported() && ExampleAllocationCounter::ActiveScopes == 0)
+	{
+		ExampleAllocationCounter::Uninstall();
+	}
+}
+
+bool FExampleAllocationScope::IsSupported()
+{
+	// With a fixed allocator class FMemory calls it directly and never looks at GMalloc
+#if PLATFORM_USES_FIXED_GMalloc_CLASS
+	return false;
+#else
+	return true;
+#endif
+}
+
+FExampleAllocationCounts FExampleAllocationScope::GetCounts() const
+{
+	FExampleAllocationCounts Counts;
+	Counts.Allocations = ExampleAllocationCounter::Totals.Allocations - StartCounts.Allocations;
+	Counts.Bytes = ExampleAllocationCounter::Totals.Bytes - StartCounts.Bytes;
+	return Counts;
+}
@@ -0,0 +1,42 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** The number of heap allocations and bytes counted by an FExampleAllocationScope */
+struct FExampleAllocationCounts
+{
+	uint64 Allocations = 0;
+	uint64 Bytes = 0;
+};
+
+/**
+ * Counts the heap allocations the game thread makes while it's alive, e.g.
+ *
+ *		FExampleAllocationScope Scope;
+ *		SNew(SExampleBorder);
+ *		UE_LOG(LogTemp, Log, TEXT("%llu allocations"), Scope.GetCounts().Allocations);
+ *
+ * The outermost scope puts a counting allocator in front of GMalloc and the allocator comes back out when that scope ends,
+ * so nothing outside of a scope pays for the counting. Meant for tools and budget checks rather than shipping code. Game thread only,
+ * allocations from other threads are never counted. Reallocs count as an allocation of the new size.
+ * Platforms that call their allocator directly(PLATFORM_USES_FIXED_GMalloc_CLASS) can't be counted, see IsSupported.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleAllocationScope
+{
+public:
+
+	FExampleAllocationScope();
+	~FExampleAllocationScope();
+
+	/** Whether or not allocations can be counted at all on this platform, if not every count comes back as 0 */
+	static bool IsSupported();
+
+	/** The allocations made since this scope started(including ones made inside any nested scopes) */
+	FExampleAllocationCounts GetCounts() const;
+
+private:
+
+	FExampleAllocationCounts StartCounts;
+};
@@ -0,0 +1,179 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleBatchAnalyzer.h"
+#include "Rendering/DrawElements.h"
+
+namespace ExampleBatchAnalyzer
+{
+	// Roughly which shader and primitive type an element ends up drawn with
+	enum EShaderClass : uint8
+	{
+		Default,
+		Font,
+		Line,
+		Unbatchable,
+	};
+
+	static EShaderClass GetShaderClass(EElementType InType)
+	{
+		switch (InType)
+		{
+		case EElementType::ET_Box:
+		case EElementType::ET_Border:
+		case EElementType::ET_Gradient:
+			return Default;
+		case EElementType::ET_Text:
+		case EElementType::ET_ShapedText:
+			return Font;
+		case EElementType::ET_Line:
+		case EElementType::ET_Spline:
+			return Line;
+		default:
+			return Unbatchable;
+		}
+	}
+}
+
+FExampleBatchAnalyzer::FBatchKey FExampleBatchAnalyzer::MakeKey(const FSlateDrawElement& InElement)
+{
+	FBatchKey Key;
+	Key.Layer = InElement.GetLayer();
+	Key.ShaderClass = ExampleBatchAnalyzer::GetShaderClass(InElement.GetElementType());
+	Key.DrawEffects = InElement.GetDrawEffects();
+	Key.ClippingIndex = InElement.GetClippingIndex();
+
+	// Boxes know which texture they'll be drawn with
+	if (InElement.GetElementType() == EElementType::ET_Box || InElement.GetElementType() == EElementType::ET_Border)
+	{
+		Key.Resource = InElement.GetDataPayload<FSlateBoxPayload>().GetResourceProxy();
+	}
+	return Key;
+}
+
+EExampleBatchBreakReason FExampleBatchAnalyzer::CompareKeys(const FBatchKey& A, const FBatchKey& B)
+{
+	if (A.Layer != B.Layer)
+	{
+		return EExampleBatchBreakReason::Layer;
+	}
+	if (A.ShaderClass == ExampleBatchAnalyzer::Unbatchable || B.ShaderClass == ExampleBatchAnalyzer::Unbatchable)
+	{
+		return EExampleBatchBreakReason::Unbatchable;
+	}
+	if (A.ShaderClass != B.ShaderClass)
+	{
+		return EExampleBatchBreakReason::ElementType;
+	}
+	if (A.Resource != B.Resource)
+	{
+		return EExampleBatchBreakReason::Resource;
+	}
+	if (A.DrawEffects != B.DrawEffects)
+	{
+		return EExampleBatchBreakReason::DrawEffect;
+	}
+	if (A.ClippingIndex != B.ClippingIndex)
+	{
+		return EExampleBatchBreakReason::Clipping;
+	}
+	return EExampleBatchBreakReason::None;
+}
+
+void FExampleBatchAnalyzer::Analyze(const FSlateWindowElementList& InElementList)
+{
+	const FSlateDrawElementArray& Elements = InElementList.GetUncachedDrawElements();
+
+	NumElements = Elements.Num();
+	NumLayers = 0;
+	Breaks.Reset();
+	FMemory::Memzero(BreakCounts);
+
+	// The batcher draws layer by layer, keeping the painted order within a layer
+	TArray<int32> Order;
+	Order.Reserve(Elements.Num());
+	for (int32 Index = 0; Index < Elements.Num(); ++Index)
+	{
+		Order.Add(Index);
+	}
+	Order.StableSort([&Elements](int32 A, int32 B)
+	{
+		return Elements[A].GetLayer() < Elements[B].GetLayer();
+	});
+
+	// The batches on the layer we're currently going through
+	TArray<FBatchKey> LayerBatches;
+
+	for (const int32 ElementIndex : Order)
+	{
+		const FBatchKey Key = MakeKey(Elements[ElementIndex]);
+
+		// Batches never span layers
+		EExampleBatchBreakReason Reason = EExampleBatchBreakReason::None;
+		if (LayerBatches.Num() == 0 || LayerBatches.Last().Layer != Key.Layer)
+		{
+			Reason = Breaks.Num() > 0 ? EExampleBatchBreakReason::Layer : EExampleBatchBreakReason::None;
+			LayerBatches.Reset();
+			++NumLayers;
+		}
+		else
+		{
+			// Within a layer we can join any batch we match, not just the last one
+			const bool bJoinedBatch = LayerBatches.ContainsByPredicate([&Key](const FBatchKey& Batch)
+			{
+				return CompareKeys(Batch, Key) == EExampleBatchBreakReason::None;
+			});
+			if (bJoinedBatch)
+			{
+				continue;
+			}
+
+			Reason = CompareKeys(LayerBatches.Last(), Key);
+		}
+
+		FExampleBatchBreak& Break = Breaks.AddDefaulted_GetRef();
+		Break.ElementIndex = ElementIndex;
+		Break.Layer = Key.Layer;
+		Break.Reason = Reason;
+		++BreakCounts[static_cast<int32>(Reason)];
+
+		LayerBatches.Add(Key);
+	}
+}
+
+const TCHAR* FExampleBatchAnalyzer::GetReasonName(EExampleBatchBreakReason InReason)
+{
+	switch (InReason)
+	{
+	case EExampleBatchBreakReason::None:			return TEXT("First batch");
+	case EExampleBatchBreakReason::Layer:			return TEXT("Layer");
+	case EExampleBatchBreakReason::ElementType:		return TEXT("Element type");
+	case EExampleBatchBreakReason::Resource:		return TEXT("Resource");
+	case EExampleBatchBreakReason::DrawEffect:		return TEXT("Draw effect");
+	case EExampleBatchBreakReason::Clipping:		return TEXT("Clipping");
+	case EExampleBatchBreakReason::Unbatchable:		return TEXT("Unbatchable");
+	default:										return TEXT("Unknown");
+	}
+}
+
+void FExampleBatchAnalyzer::LogReport(FOutputDevice& Ar, int32 InMaxBreaksToPrint) const
+{
+	Ar.Logf(TEXT("Batches: %d elements on %d layers make %d batches(%.2f elements per batch)"),
+		NumElements, NumLayers, GetNumBatches(), GetNumBatches() > 0 ? double(NumElements) / GetNumBatches() : 0.0);
+
+	for (int32 Reason = 1; Reason < static_cast<int32>(EExampleBatchBreakReason::Count); ++Reason)
+	{
+		Ar.Logf(TEXT("  %-14s %d breaks"), GetReasonName(static_cast<EExampleBatchBreakReason>(Reason)), BreakCounts[Reason]);
+	}
+
+	const int32 NumToPrint = FMath::Min(InMaxBreaksToPrint, Breaks.Num());
+	for (int32 Index = 0; Index < NumToPrint; ++Index)
+	{
+		const FExampleBatchBreak& Break = Breaks[Index];
+		Ar.Logf(TEXT("  Batch %d: element %d on layer %d, %s"), Index, Break.ElementIndex, Break.Layer, GetReasonName(Break.Reason));
+	}
+	if (NumToPrint < Breaks.Num())
+	{
+		Ar.Logf(TEXT("  ...and %d more"), Breaks.Num() - NumToPrint);
+	}
+}
@@ -0,0 +1,91 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Rendering/RenderingCommon.h"
+
+class FSlateWindowElementList;
+class FSlateDrawElement;
+
+/** Why a draw element couldn't be added to the batch before it */
+enum class EExampleBatchBreakReason : uint8
+{
+	/** The very first batch, nothing broke */
+	None,
+	/** The element is on a different layer, batches never span layers */
+	Layer,
+	/** The element needs a different shader or primitive type(e.g. text after a box) */
+	ElementType,
+	/** The element draws a different texture/material */
+	Resource,
+	/** The element has different draw effects(e.g. DisabledEffect) */
+	DrawEffect,
+	/** The element is clipped differently */
+	Clipping,
+	/** Some elements(custom drawers, viewports, post process...etc) always get a batch of their own */
+	Unbatchable,
+
+	Count
+};
+
+/** One batch break found by an FExampleBatchAnalyzer */
+struct FExampleBatchBreak
+{
+	/** The index in the element list of the element that started the new batch */
+	int32 ElementIndex = INDEX_NONE;
+	int32 Layer = 0;
+	EExampleBatchBreakReason Reason = EExampleBatchBreakReason::None;
+};
+
+/**
+ * Works out how many render batches an element list turns into and why each batch had to be started, without a renderer.
+ *
+ * This mirrors how slate's batcher merges: elements are grouped by layer, and within a layer an element joins any existing batch
+ * with the same shader, primitive type, texture, draw effects and clipping. Break reasons compare a new batch against the last batch
+ * on the same layer. Only uncached elements are looked at, and text/lines can't tell us their textures so they're only compared by type.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleBatchAnalyzer
+{
+public:
+
+	/** Clears out the previous results and analyzes the given element list */
+	void Analyze(const FSlateWindowElementList& InElementList);
+
+	int32 GetNumElements() const { return NumElements; }
+	int32 GetNumBatches() const { return Breaks.Num(); }
+	int32 GetNumLayers() const { return NumLayers; }
+
+	/** Every batch we found, in the order they'd be drawn, along with why it was started */
+	const TArray<FExampleBatchBreak>& GetBreaks() const { return Breaks; }
+
+	/** How many batches were started for the given reason */
+	int32 GetNumBreaks(EExampleBatchBreakReason InReason) const { return BreakCounts[static_cast<int32>(InReason)]; }
+
+	/** Prints the summary, and the first InMaxBreaksToPrint breaks one by one */
+	void LogReport(FOutputDevice& Ar, int32 InMaxBreaksToPrint = 20) const;
+
+	static const TCHAR* GetReasonName(EExampleBatchBreakReason InReason);
+
+private:
+
+	/** What has to match for two elements to end up in the same batch */
+	struct FBatchKey
+	{
+		int32 Layer = 0;
+		uint8 ShaderClass = 0;
+		const void* Resource = nullptr;
+		ESlateDrawEffect DrawEffects = ESlateDrawEffect::None;
+		int32 ClippingIndex = INDEX_NONE;
+	};
+
+	static FBatchKey MakeKey(const FSlateDrawElement& InElement);
+
+	/** The first thing that differs between two keys on the same layer */
+	static EExampleBatchBreakReason CompareKeys(const FBatchKey& A, const FBatchKey& B);
+
+	int32 NumElements = 0;
+	int32 NumLayers = 0;
+	TArray<FExampleBatchBreak> Breaks;
+	int32 BreakCounts[static_cast<int32>(EExampleBatchBreakReason::Count)] = {};
+};
@@ -0,0 +1,1173 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleBorder.h"
+#include "ExampleBorderSlot.h"
+#include "SExampleBorder.h"
+#include "ObjectEditorUtils.h"
+#include "Slate/SlateBrushAsset.h"
+#include "ExampleInputLatency.h"
+#include "ExampleBrushPool.h"
+#include "ExampleBorderStyleRegistry.h"
+#include "ExampleBorderViewModel.h"
+#include "ExampleUIStats.h"
+#include "Blueprint/UserWidget.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Widgets/SNullWidget.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+#define LOCTEXT_NAMESPACE "UMG"
+
+UExampleBorder::UExampleBorder()    
+{
+	bIsVariable = false;
+	bShowEffectWhenDisabled = true;
+}
+
+/** What every border draws while a soft brush streams in, pooled once and shared by all of them */
+static TSharedRef<const FSlateBrush> GetLoadingPlaceholderBrush()
+{
+	static TSharedPtr<const FSlateBrush> LoadingBrush;
+	if ( !LoadingBrush.IsValid() )
+	{
+		// No texture so there's nothing to load, just a dark see-through box where the real brush will go
+		FSlateBrush Brush;
+		Brush.TintColor = FSlateColor(FLinearColor(0.02f, 0.02f, 0.02f, 0.5f));
+		LoadingBrush = FExampleBrushPool::Get().Intern(Brush);
+	}
+	return LoadingBrush.ToSharedRef();
+}
+
+#if WITH_EDITOR
+
+static int32 GExampleDesignerReuseBorders = 1;
+static FAutoConsoleVariableRef CVarExampleDesignerReuseBorders(
+	TEXT("ExampleUI.Designer.ReuseBorders"),
+	GExampleDesignerReuseBorders,
+	TEXT("When the widget designer rebuilds its preview, every border takes back the slate widget it had in the last one instead of building a new one."));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleDesignerStatsCommand(
+	TEXT("ExampleUI.Designer.Stats"),
+	TEXT("Prints how many border slate widgets got built and how many got reused by designer preview rebuilds since the last time this was run. Run it, make an edit in the designer and run it again to see what the edit rebuilt."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		Ar.Logf(TEXT("Border slate widgets: %u built, %u reused from the last designer preview"), FExampleUIStats::BorderWidgetsBuilt, FExampleUIStats::BorderWidgetsReused);
+		FExampleUIStats::BorderWidgetsBuilt = 0;
+		FExampleUIStats::BorderWidgetsReused = 0;
+	}));
+
+/**
+ * The slate widgets of the borders in the designer preview that just got torn down, by where each border sits in its widget blueprint.
+ * The next preview gets built straight after the last one is released, whatever it hasn't taken back by the next tick gets let go of.
+ */
+static TMap<FString, TSharedPtr<SExampleBorder>> GExampleDesignerBorders;
+static FDelegateHandle GExampleDesignerBordersFlushHandle;
+
+/** Where the border sits in its widget blueprint, which is the same for its counterpart in the next preview. Empty if it isn't in a user widget */
+static FString GetDesignerBorderKey(const UExampleBorder* Border)
+{
+	// Preview widgets keep their names from the widget tree, only the outermost user widget's own name changes from one preview to the next.
+	// Going from that one rather than our own user widget keeps the borders inside nested user widgets apart
+	const UUserWidget* RootWidget = nullptr;
+	for ( const UObject* Outer = Border->GetOuter(); Outer; Outer = Outer->GetOuter() )
+	{
+		if ( const UUserWidget* UserWidget = Cast<UUserWidget>(Outer) )
+		{
+			RootWidget = UserWidget;
+		}
+	}
+	return RootWidget ? RootWidget->GetClass()->GetPathName() + TEXT(":") + Border->GetPathName(RootWidget) : FString();
+}
+
+static void KeepDesignerBorder(const UExampleBorder* Border, const TSharedPtr<SExampleBorder>& SlateBorder)
+{
+	const FString Key = GetDesignerBorderKey(Border);
+	if ( !GExampleDesignerReuseBorders || Key.IsEmpty() )
+	{
+		return;
+	}
+
+	GExampleDesignerBorders.Add(Key, SlateBorder);
+	if ( !GExampleDesignerBordersFlushHandle.IsValid() )
+	{
+		GExampleDesignerBordersFlushHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			GExampleDesignerBorders.Reset();
+			GExampleDesignerBordersFlushHandle.Reset();
+			return false;
+		}));
+	}
+}
+
+static TSharedPtr<SExampleBorder> TakeDesignerBorder(const UExampleBorder* Border)
+{
+	TSharedPtr<SExampleBorder> SlateBorder;
+	if ( GExampleDesignerBorders.Num() > 0 )
+	{
+		GExampleDesignerBorders.RemoveAndCopyValue(GetDesignerBorderKey(Border), SlateBorder);
+	}
+	return SlateBorder;
+}
+
+#endif
+
+void UExampleBorder::SetContentColorAndOpacity(FLinearColor InContentColorAndOpacity)
+{
+	ContentColorAndOpacity = InContentColorAndOpacity;
+	if ( UnstyledAppearance.IsSet() )
+	{
+		UnstyledAppearance->ContentColorAndOpacity = InContentColorAndOpacity;
+	}
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetColorAndOpacity(InContentColorAndOpacity);
+		// Pass along any input that led to this change so we can measure when it finally gets painted
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetPadding(FMargin InPadding)
+{
+	Padding = InPadding;
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetPadding(InPadding);
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
+{
+	HorizontalAlignment = InHorizontalAlignment;
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetHAlign(InHorizontalAlignment);
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
+{
+	VerticalAlignment = InVerticalAlignment;
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetVAlign(InVerticalAlignment);
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetBrushColor(FLinearColor InBrushColor)
+{
+	BrushColor = InBrushColor;
+	if ( UnstyledAppearance.IsSet() )
+	{
+		UnstyledAppearance->BrushColor = InBrushColor;
+	}
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetBorderBackgroundColor(InBrushColor);
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetBrush(const FSlateBrush& InBrush)
+{
+	CancelBrushLoad();
+
+	// A brush set on us directly is ours, it wins over whatever shared brush we were drawing.
+	// It still gets interned, every other border that's been given the same brush shares the one copy with us
+	InternedBackground = FExampleBrushPool::Get().Intern(InBrush);
+	Background = FSlateBrush();
+	SharedBackground.Reset();
+	if ( UnstyledAppearance.IsSet() )
+	{
+		UnstyledAppearance->SharedBackground.Reset();
+	}
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetBorderImage(GetBackgroundBrush());
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetBrushFromAsset(USlateBrushAsset* InAsset)
+{
+	CancelBrushLoad();
+
+	// Every border using the same asset ends up pointing at the same brush
+	InternedBackground = FExampleBrushPool::Get().Intern(InAsset ? InAsset->Brush : FSlateBrush());
+	Background = FSlateBrush();
+	SharedBackground.Reset();
+	if ( UnstyledAppearance.IsSet() )
+	{
+		UnstyledAppearance->SharedBackground.Reset();
+	}
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetBorderImage(GetBackgroundBrush());
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetBrushFromTexture(UTexture2D* InTexture)
+{
+	CancelBrushLoad();
+
+	// We're about to change the brush, so we need our own copy of it if we're sharing one
+	MakeBackgroundUnique();
+	Background.SetResourceObject(InTexture);
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetBorderImage(&Background);
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetBrushFromMaterial(UMaterialInterface* InMaterial)
+{
+	if (!InMaterial)
+	{
+		UE_LOG(LogSlate, Log, TEXT("UBorder::SetBrushFromMaterial.  Incoming material is null"));
+	}
+
+	CancelBrushLoad();
+
+	MakeBackgroundUnique();
+	Background.SetResourceObject(InMaterial);
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetBorderImage(&Background);
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetBrushFromSoftAsset(TSoftObjectPtr<USlateBrushAsset> InAsset)
+{
+	LoadBrushAsync(InAsset.ToSoftObjectPath(), [this](UObject* Loaded)
+	{
+		SetBrushFromAsset(Cast<USlateBrushAsset>(Loaded));
+	});
+}
+
+void UExampleBorder::SetBrushFromSoftTexture(TSoftObjectPtr<UTexture2D> InTexture)
+{
+	// The texture goes on the brush we had, not on the placeholder we'll be showing in the meantime
+	FSlateBrush NewBrush(GetBrushIgnoringLoading());
+	LoadBrushAsync(InTexture.ToSoftObjectPath(), [this, NewBrush](UObject* Loaded) mutable
+	{
+		// One pooled brush and a single SetBorderImage, so swapping it in is just the one repaint
+		NewBrush.SetResourceObject(Cast<UTexture2D>(Loaded));
+		SetBrush(NewBrush);
+	});
+}
+
+void UExampleBorder::SetBrushFromSoftMaterial(TSoftObjectPtr<UMaterialInterface> InMaterial)
+{
+	FSlateBrush NewBrush(GetBrushIgnoringLoading());
+	LoadBrushAsync(InMaterial.ToSoftObjectPath(), [this, NewBrush](UObject* Loaded) mutable
+	{
+		NewBrush.SetResourceObject(Cast<UMaterialInterface>(Loaded));
+		SetBrush(NewBrush);
+	});
+}
+
+void UExampleBorder::LoadBrushAsync(const FSoftObjectPath& InPath, TFunction<void(UObject*)>&& ApplyLoaded)
+{
+	// Already loaded(or nothing to load) means there's nothing to wait for
+	UObject* AlreadyLoaded = InPath.ResolveObject();
+	if (InPath.IsNull() || AlreadyLoaded)
+	{
+		ApplyLoaded(AlreadyLoaded);
+		return;
+	}
+
+	// If we're already showing the placeholder, what we had is whatever was there before it
+	TSharedPtr<const FSlateBrush> SharedBackgroundBeforeLoading = PendingBrushLoad.IsValid() ? PendingBrushLoad->SharedBackgroundBeforeLoading : SharedBackground;
+	CancelBrushLoad();
+
+	PendingBrushLoad = MakeUnique<FPendingBrushLoad>();
+	PendingBrushLoad->SharedBackgroundBeforeLoading = MoveTemp(SharedBackgroundBeforeLoading);
+
+	SetSharedBackground(GetLoadingPlaceholderBrush());
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetBorderImage(GetBackgroundBrush());
+	}
+
+	// Weak so a border that's gone by the time it loads doesn't get called
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(InPath,
+		FStreamableDelegate::CreateWeakLambda(this, [this, InPath, ApplyLoaded = MoveTemp(ApplyLoaded)]()
+		{
+			PendingBrushLoad.Reset();
+			ApplyLoaded(InPath.ResolveObject());
+		}));
+
+	if (!Handle.IsValid())
+	{
+		// It couldn't even start loading, so put back what we had rather than showing the placeholder forever
+		CancelBrushLoad(true);
+	}
+	else if (PendingBrushLoad.IsValid())
+	{
+		// If it had already finished our lambda has been called and there's nothing left to wait on
+		PendingBrushLoad->Handle = Handle;
+	}
+}
+
+void UExampleBorder::CancelBrushLoad(bool bRestoreBrush)
+{
+	if ( !PendingBrushLoad.IsValid() )
+	{
+		return;
+	}
+
+	if ( PendingBrushLoad->Handle.IsValid() )
+	{
+		PendingBrushLoad->Handle->CancelHandle();
+	}
+
+	if ( bRestoreBrush )
+	{
+		SharedBackground = PendingBrushLoad->SharedBackgroundBeforeLoading;
+		if ( MyBorder.IsValid() )
+		{
+			MyBorder->SetBorderImage(GetBackgroundBrush());
+		}
+	}
+
+	PendingBrushLoad.Reset();
+}
+
+const FSlateBrush& UExampleBorder::GetBrushIgnoringLoading() const
+{
+	if ( PendingBrushLoad.IsValid() )
+	{
+		return PendingBrushLoad->SharedBackgroundBeforeLoading.IsValid() ? *PendingBrushLoad->SharedBackgroundBeforeLoading : GetOwnBackground();
+	}
+	return *GetBackgroundBrush();
+}
+
+UMaterialInstanceDynamic* UExampleBorder::GetDynamicMaterial()
+{
+	UMaterialInterface* Material = nullptr;
+
+	// Grab the material from the background brush
+	UObject* Resource = GetBackgroundBrush()->GetResourceObject();
+	Material = Cast<UMaterialInterface>(Resource);
+
+	// If that material is valid
+	if (Material)
+	{
+		// Try to get a dynamic material from it
+		UMaterialInstanceDynamic* DynamicMaterial = Cast<UMaterialInstanceDynamic>(Material);
+
+		// If the dynamic material is null
+		if (!DynamicMaterial)
+		{
+			// Then create a new one and update our background brush to use it,
+			// the dynamic material is ours alone so we can't keep sharing the brush
+			DynamicMaterial = UMaterialInstanceDynamic::Create(Material, this);
+			MakeBackgroundUnique();
+			Background.SetResourceObject(DynamicMaterial);
+
+			// Update our slate widget to use it
+			if (MyBorder.IsValid())
+			{
+				MyBorder->SetBorderImage(&Background);
+			}
+		}
+
+		// And finally, return that dynamic material
+		return DynamicMaterial;
+	}
+
+	// Otherwise return null
+	return nullptr;
+}
+
+void UExampleBorder::SetDesiredSizeScale(FVector2D InScale)
+{
+	DesiredSizeScale = InScale;
+	if (MyBorder.IsValid())
+	{
+		MyBorder->SetDesiredSizeScale(InScale);
+		MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+	}
+}
+
+void UExampleBorder::SetRetainContent(bool bInRetainContent)
+{
+	bRetainContent = bInRetainContent;
+	if (MyBorder.IsValid())
+	{
+		MyBorder->SetRetainContent(bRetainContent);
+	}
+}
+
+void UExampleBorder::SetRefreshRate(float InRefreshRate)
+{
+	RefreshRate = FMath::Max(InRefreshRate, 0.0f);
+	if (MyBorder.IsValid())
+	{
+		MyBorder->SetRefreshRate(RefreshRate);
+	}
+}
+
+void UExampleBorder::SynchronizeProperties()
+{
+#if WITH_EDITOR
+	// PostEditChangeProperty patches the edited property in itself, or synchronizes us when it can't
+	if ( bDeferDesignerSynchronize )
+	{
+		return;
+	}
+#endif
+
+	Super::SynchronizeProperties();
+
+	// Low priority borders can wait a few frames, the designer always wants to see changes right away
+	if ( SyncPriority != EExampleBorderSyncPriority::Immediate && FExampleSyncScheduler::IsEnabled() && !IsDesignTime() )
+	{
+		FExampleSyncScheduler::Get().Schedule(this);
+		return;
+	}
+
+	SynchronizeBorder();
+}
+
+void UExampleBorder::RunDeferredSync()
+{
+	bSyncPending = false;
+
+	// We may have been released while we waited
+	if ( MyBorder.IsValid() )
+	{
+		SynchronizeBorder();
+
+		// Our slot held off on synchronizing while we were pending, since it only sets things on our slate widget
+		if ( UPanelSlot* ContentSlot = GetContentSlot() )
+		{
+			ContentSlot->SynchronizeProperties();
+		}
+	}
+}
+
+void UExampleBorder::SynchronizeBorder()
+{
+	// Pick up the latest version of our style(if we have one) before we push everything to our slate widget,
+	// we're about to set all of these anyway so there's no need for the style to touch the slate widget itself
+	UExampleBorderStyleRegistry* StyleRegistry = UExampleBorderStyleRegistry::Get();
+	if ( !StyleId.IsNone() )
+	{
+		if ( StyleRegistry )
+		{
+			StyleRegistry->RegisterBorder(this);
+			StyleRegistry->ApplyStyleTo(this, false);
+		}
+	}
+	else if ( RestoreUnstyledAppearance() && StyleRegistry )
+	{
+		// Our style ID got cleared without going through SetStyleId(the details panel for example)
+		StyleRegistry->UnregisterBorder(this);
+	}
+
+	// A view model pushes its changes to us, so we take its current values as plain values and leave the bindings alone,
+	// that way our slate widget never has to call back into us every frame to find out nothing changed
+	const bool bUseBindings = ViewModel == nullptr;
+	if ( ViewModel )
+	{
+		ContentColorAndOpacity = ViewModel->GetContentColorAndOpacity();
+		BrushColor = ViewModel->GetBrushColor();
+		SetSharedBackground(FExampleBrushPool::Get().Intern(ViewModel->GetBackground()));
+	}
+
+	// Setting up our attribute bindings and values
+	const TAttribute<FLinearColor> ContentColorAndOpacityBinding = bUseBindings
+		? PROPERTY_BINDING(FLinearColor, ContentColorAndOpacity)
+		: TAttribute<FLinearColor>(ContentColorAndOpacity);
+	const TAttribute<FSlateColor> BrushColorBinding = bUseBindings
+		? OPTIONAL_BINDING_CONVERT(FLinearColor, BrushColor, FSlateColor, ConvertLinearColorToSlateColor)
+		: TAttribute<FSlateColor>(BrushColor);
+	// This one is binding the attribute to a function rather than a value, otherwise we just point at whichever brush we draw
+	const TAttribute<const FSlateBrush*> ImageBinding = ( bUseBindings && BackgroundDelegate.IsBound() && !IsDesignTime() )
+		? OPTIONAL_BINDING_CONVERT(FSlateBrush, Background, const FSlateBrush*, ConvertImage)
+		: TAttribute<const FSlateBrush*>(GetBackgroundBrush());
+
+	// Telling our slate widget to update its values to those attributes
+	// by calling those functions that we made in our slate widget!
+	MyBorder->SetPadding(Padding);
+	MyBorder->SetBorderBackgroundColor(BrushColorBinding);
+	MyBorder->SetColorAndOpacity(ContentColorAndOpacityBinding);
+
+	MyBorder->SetBorderImage(ImageBinding);
+	
+	MyBorder->SetDesiredSizeScale(DesiredSizeScale);
+	MyBorder->SetShowEffectWhenDisabled(bShowEffectWhenDisabled != 0);
+	MyBorder->SetRetainContent(bRetainContent);
+	MyBorder->SetRefreshRate(RefreshRate);
+
+	// Binding our delegates with our slate widget's delegates, but only the ones someone is actually listening to.
+	// Each binding is a heap allocation on our slate widget(and most borders never listen to any input at all),
+	// the native accessors hook theirs up when they get used after this point
+	if ( OnMouseButtonDownEvent.IsBound() || MouseButtonDownNative.IsBound() )
+	{
+		MyBorder->SetOnMouseButtonDown(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseButtonDown));
+	}
+	if ( OnMouseButtonUpEvent.IsBound() || MouseButtonUpNative.IsBound() )
+	{
+		MyBorder->SetOnMouseButtonUp(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseButtonUp));
+	}
+	if ( OnMouseMoveEvent.IsBound() || MouseMoveNative.IsBound() )
+	{
+		MyBorder->SetOnMouseMove(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseMove));
+	}
+	if ( OnMouseDoubleClickEvent.IsBound() || MouseDoubleClickNative.IsBound() )
+	{
+		MyBorder->SetOnMouseDoubleClick(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseDoubleClick));
+	}
+}
+
+void UExampleBorder::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+#if WITH_EDITOR
+	// The designer is most likely tearing down its preview to build a new one, the border that takes our place in it can have our slate widget
+	if ( MyBorder.IsValid() && IsDesignTime() )
+	{
+		KeepDesignerBorder(this, MyBorder);
+	}
+#endif
+
+	// This is pretty simple, just reset the pointer which handles immediate garbage collection and such
+	MyBorder.Reset();
+
+	// Nothing's left to show a soft brush on, so stop streaming it and go back to what we had
+	CancelBrushLoad(true);
+
+	// Without a slate widget there's nothing for style changes to update
+	if (UExampleBorderStyleRegistry* StyleRegistry = UExampleBorderStyleRegistry::Get())
+	{
+		StyleRegistry->UnregisterBorder(this);
+	}
+}
+
+void UExampleBorder::BeginDestroy()
+{
+	CancelBrushLoad();
+
+	// Our pooled brushes leave the pool straight away if we were the last ones using them
+	SharedBackground.Reset();
+	InternedBackground.Reset();
+	UnstyledAppearance.Reset();
+
+	Super::BeginDestroy();
+}
+
+void UExampleBorder::Serialize(FArchive& Ar)
+{
+	// Saving, duplicating and undo all expect our brush to be in Background, so it goes back in there while they look
+	if ( Ar.IsSaving() && InternedBackground.IsValid() )
+	{
+		Background = *InternedBackground;
+		Super::Serialize(Ar);
+		Background = FSlateBrush();
+		return;
+	}
+
+	Super::Serialize(Ar);
+
+	// Whatever got loaded into Background is our brush now
+	if ( Ar.IsLoading() )
+	{
+		InternedBackground.Reset();
+	}
+}
+
+void UExampleBorder::PostLoad()
+{
+	Super::PostLoad();
+
+	// If we have any children
+	if (GetChildrenCount() > 0)
+	{
+		// Get our panel slot
+		if (UPanelSlot* PanelSlot = GetContentSlot())
+		{
+			// Try to get our custom border slot
+			UExampleBorderSlot* BorderSlot = Cast<UExampleBorderSlot>(PanelSlot);
+			// If its null
+			if (!BorderSlot)
+			{
+				// Then make a new one and manually connect it up
+				BorderSlot = NewObject<UExampleBorderSlot>(this);
+				// We have to update its content to ours
+				BorderSlot->Content = GetContentSlot()->Content;
+				// Tell that content that its slot is our newly created border slot
+				BorderSlot->Content->Slot = BorderSlot;
+				// And then update our parent variable's Slots array at index 0 to this slot
+				Slots[0] = BorderSlot;
+			}
+		}
+	}
+}
+
+#if WITH_EDITOR
+
+void UExampleBorder::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// UWidget's version ends by calling SynchronizeProperties, which resets every property on our slate widget(and invalidates it
+	// for all of them) no matter what changed. Everything else up the chain still runs, only that synchronize is held back for us to do below
+	{
+		TGuardValue<bool> DeferSynchronize(bDeferDesignerSynchronize, true);
+		Super::PostEditChangeProperty(PropertyChangedEvent);
+	}
+
+	// This is the same way we did it in our slot class
+	static bool IsReentrant = false;
+
+	if ( !IsReentrant )
+	{
+		IsReentrant = true;
+
+		if ( PropertyChangedEvent.Property )
+		{
+			static const FName PaddingName("Padding");
+			static const FName BackgroundName("Background");
+			static const FName HorizontalAlignmentName("HorizontalAlignment");
+			static const FName VerticalAlignmentName("VerticalAlignment");
+
+			const FName PropertyName = PropertyChangedEvent.Property->GetFName();
+
+			// Editing the brush directly means we stop sharing one
+			if (PropertyName == BackgroundName)
+			{
+				SharedBackground.Reset();
+				InternedBackground.Reset();
+			}
+			
+			if (UExampleBorderSlot* BorderSlot = Cast<UExampleBorderSlot>(GetContentSlot()))
+			{
+				if (PropertyName == PaddingName)
+				{
+					FObjectEditorUtils::MigratePropertyValue(this, PaddingName, BorderSlot, PaddingName);
+				}
+				else if (PropertyName == HorizontalAlignmentName)
+				{
+					FObjectEditorUtils::MigratePropertyValue(this, HorizontalAlignmentName, BorderSlot, HorizontalAlignmentName);
+				}
+				else if (PropertyName == VerticalAlignmentName)
+				{
+					FObjectEditorUtils::MigratePropertyValue(this, VerticalAlignmentName, BorderSlot, VerticalAlignmentName);
+				}
+			}
+		}
+
+		IsReentrant = false;
+	}
+
+	// Editing something inside a struct(like the brush's tint) changes the member property, that's the one we care about
+	const FName MemberName = PropertyChangedEvent.MemberProperty ? PropertyChangedEvent.MemberProperty->GetFName() : NAME_None;
+	if ( MyBorder.IsValid() && !PatchDesignerProperty(MemberName) )
+	{
+		SynchronizeProperties();
+	}
+}
+
+bool UExampleBorder::PatchDesignerProperty(FName PropertyName)
+{
+	// A style or view model decides our appearance at sync time, and a pending sync would undo our patch anyway
+	if ( PropertyName.IsNone() || !StyleId.IsNone() || ViewModel || IsSyncPending() )
+	{
+		return false;
+	}
+
+	static const FName BrushColorName(GET_MEMBER_NAME_CHECKED(UExampleBorder, BrushColor));
+	static const FName ContentColorAndOpacityName(GET_MEMBER_NAME_CHECKED(UExampleBorder, ContentColorAndOpacity));
+	static const FName BackgroundName(GET_MEMBER_NAME_CHECKED(UExampleBorder, Background));
+	static const FName PaddingName(GET_MEMBER_NAME_CHECKED(UExampleBorder, Padding));
+	static const FName HorizontalAlignmentName(GET_MEMBER_NAME_CHECKED(UExampleBorder, HorizontalAlignment));
+	static const FName VerticalAlignmentName(GET_MEMBER_NAME_CHECKED(UExampleBorder, VerticalAlignment));
+	static const FName DesiredSizeScaleName(GET_MEMBER_NAME_CHECKED(UExampleBorder, DesiredSizeScale));
+	static const FName ShowEffectWhenDisabledName(GET_MEMBER_NAME_CHECKED(UExampleBorder, bShowEffectWhenDisabled));
+	static const FName RetainContentName(GET_MEMBER_NAME_CHECKED(UExampleBorder, bRetainContent));
+	static const FName RefreshRateName(GET_MEMBER_NAME_CHECKED(UExampleBorder, RefreshRate));
+	static const FName SyncPriorityName(GET_MEMBER_NAME_CHECKED(UExampleBorder, SyncPriority));
+
+	if ( PropertyName == BrushColorName )
+	{
+		SetBrushColor(BrushColor);
+	}
+	else if ( PropertyName == ContentColorAndOpacityName )
+	{
+		SetContentColorAndOpacity(ContentColorAndOpacity);
+	}
+	else if ( PropertyName == BackgroundName )
+	{
+		// Often the same pointer as before(our own brush, edited in place), SetBorderImage compares the contents
+		MyBorder->SetBorderImage(GetBackgroundBrush());
+	}
+	else if ( PropertyName == PaddingName )
+	{
+		SetPadding(Padding);
+	}
+	else if ( PropertyName == HorizontalAlignmentName )
+	{
+		SetHorizontalAlignment(HorizontalAlignment);
+	}
+	else if ( PropertyName == VerticalAlignmentName )
+	{
+		SetVerticalAlignment(VerticalAlignment);
+	}
+	else if ( PropertyName == DesiredSizeScaleName )
+	{
+		SetDesiredSizeScale(DesiredSizeScale);
+	}
+	else if ( PropertyName == ShowEffectWhenDisabledName )
+	{
+		MyBorder->SetShowEffectWhenDisabled(bShowEffectWhenDisabled != 0);
+	}
+	else if ( PropertyName == RetainContentName )
+	{
+		SetRetainContent(bRetainContent);
+	}
+	else if ( PropertyName == RefreshRateName )
+	{
+		SetRefreshRate(RefreshRate);
+	}
+	else if ( PropertyName != SyncPriorityName ) // Only matters the next time we synchronize, nothing to patch
+	{
+		return false;
+	}
+
+	return true;
+}
+
+const FText UExampleBorder::GetPaletteCategory()
+{
+	// We're placing our widget in the common category of the palette list
+	return LOCTEXT("Common", "Common");
+}
+
+#endif
+
+UClass* UExampleBorder::GetSlotClass() const
+{
+	// Returns the class of our slot
+	return UExampleBorderSlot::StaticClass();
+}
+
+void UExampleBorder::OnSlotAdded(UPanelSlot* InSlot)
+{
+	// Copy the content properties into the new slot so that it matches what has been setup
+	// so far by the user.
+	UExampleBorderSlot* BorderSlot = CastChecked<UExampleBorderSlot>(InSlot);
+	BorderSlot->Padding = Padding;
+	BorderSlot->HorizontalAlignment = HorizontalAlignment;
+	BorderSlot->VerticalAlignment = VerticalAlignment;
+
+	// Add the child to the live slot if it already exists
+	if ( MyBorder.IsValid() )
+	{
+		// Construct the underlying slot.
+		BorderSlot->BuildSlot(MyBorder.ToSharedRef());
+	}
+}
+
+void UExampleBorder::OnSlotRemoved(UPanelSlot* InSlot)
+{
+	// Remove the widget from the live slot if it exists.
+	if ( MyBorder.IsValid() )
+	{
+		MyBorder->SetContent(SNullWidget::NullWidget);
+	}
+}
+
+TSharedRef<SWidget> UExampleBorder::RebuildWidget()
+{
+	InternBackground();
+
+#if WITH_EDITOR
+	// The designer rebuilds its whole preview for most edits, rather than starting from scratch every time we take back the slate widget
+	// we had in the last one. Our setters only invalidate what actually changed, and SynchronizeProperties is about to go through all of them
+	TSharedPtr<SExampleBorder> DesignerBorder;
+	if ( IsDesignTime() )
+	{
+		DesignerBorder = TakeDesignerBorder(this);
+	}
+	if ( DesignerBorder.IsValid() )
+	{
+		FExampleUIStats::CountBorderWidgetReused();
+		MyBorder = DesignerBorder;
+
+		// It still points at the last preview border's brush, which is about to go away
+		MyBorder->SetBorderImage(GetBackgroundBrush());
+		MyBorder->SetHAlign(HorizontalAlignment);
+		MyBorder->SetVAlign(VerticalAlignment);
+
+		// These went to the last preview border, synchronizing binds the ones we need again
+		MyBorder->SetOnMouseButtonDown(FPointerEventHandler());
+		MyBorder->SetOnMouseButtonUp(FPointerEventHandler());
+		MyBorder->SetOnMouseMove(FPointerEventHandler());
+		MyBorder->SetOnMouseDoubleClick(FPointerEventHandler());
+
+		// Our content might've been taken out since
+		if ( GetChildrenCount() == 0 )
+		{
+			MyBorder->SetContent(SNullWidget::NullWidget);
+		}
+	}
+	else
+#endif
+	{
+		FExampleUIStats::CountBorderWidgetBuilt();
+
+		// Creates our slate widget, SNew is the keyword for new widget essentially.
+		// We hand it our plain values straight away so that if our synchronization gets deferred we still look right in the meantime
+		MyBorder = SNew(SExampleBorder)
+			.BorderImage(GetBackgroundBrush())
+			.BorderBackgroundColor(BrushColor)
+			.ColorAndOpacity(ContentColorAndOpacity)
+			.Padding(Padding)
+			.HAlign(HorizontalAlignment)
+			.VAlign(VerticalAlignment)
+			.DesiredSizeScale(DesiredSizeScale)
+			.RetainContent(bRetainContent)
+			.RefreshRate(RefreshRate);
+	}
+
+	// If we have any children
+	if ( GetChildrenCount() > 0 )
+	{
+		// Then tell our to build itself while passing in our slate widget ptr
+		Cast<UExampleBorderSlot>(GetContentSlot())->BuildSlot(MyBorder.ToSharedRef());
+	}
+
+	// Return our created slate widget
+	return MyBorder.ToSharedRef();
+}
+
+FPointerEventHandler& UExampleBorder::OnMouseButtonDownNative()
+{
+	// Whoever asked for this is about to bind to it, so make sure our slate widget sends us the event
+	if ( MyBorder.IsValid() && !MouseButtonDownNative.IsBound() )
+	{
+		MyBorder->SetOnMouseButtonDown(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseButtonDown));
+	}
+	return MouseButtonDownNative;
+}
+
+FPointerEventHandler& UExampleBorder::OnMouseButtonUpNative()
+{
+	if ( MyBorder.IsValid() && !MouseButtonUpNative.IsBound() )
+	{
+		MyBorder->SetOnMouseButtonUp(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseButtonUp));
+	}
+	return MouseButtonUpNative;
+}
+
+FPointerEventHandler& UExampleBorder::OnMouseMoveNative()
+{
+	if ( MyBorder.IsValid() && !MouseMoveNative.IsBound() )
+	{
+		MyBorder->SetOnMouseMove(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseMove));
+	}
+	return MouseMoveNative;
+}
+
+FPointerEventHandler& UExampleBorder::OnMouseDoubleClickNative()
+{
+	if ( MyBorder.IsValid() && !MouseDoubleClickNative.IsBound() )
+	{
+		MyBorder->SetOnMouseDoubleClick(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseDoubleClick));
+	}
+	return MouseDoubleClickNative;
+}
+
+FReply UExampleBorder::HandleMouseButtonDown(const FGeometry& Geometry, const FPointerEvent& MouseEvent)
+{
+	// Pointer input counts as input for our latency measurements too
+	FExampleInputLatencyTracker::StampInput();
+
+	// The native handler goes first since its just a regular function call,
+	// only if it didn't handle the event do we pay for the trip into the Blueprint VM
+	if ( MouseButtonDownNative.IsBound() )
+	{
+		const FReply NativeReply = MouseButtonDownNative.Execute(Geometry, MouseEvent);
+		if ( NativeReply.IsEventHandled() )
+		{
+			return NativeReply;
+		}
+	}
+
+	if ( OnMouseButtonDownEvent.IsBound() )
+	{
+		return OnMouseButtonDownEvent.Execute(Geometry, MouseEvent).NativeReply;
+	}
+
+	return FReply::Unhandled();
+}
+
+FReply UExampleBorder::HandleMouseButtonUp(const FGeometry& Geometry, const FPointerEvent& MouseEvent)
+{
+	FExampleInputLatencyTracker::StampInput();
+
+	if ( MouseButtonUpNative.IsBound() )
+	{
+		const FReply NativeReply = MouseButtonUpNative.Execute(Geometry, MouseEvent);
+		if ( NativeReply.IsEventHandled() )
+		{
+			return NativeReply;
+		}
+	}
+
+	if ( OnMouseButtonUpEvent.IsBound() )
+	{
+		return OnMouseButtonUpEvent.Execute(Geometry, MouseEvent).NativeReply;
+	}
+
+	return FReply::Unhandled();
+}
+
+FReply UExampleBorder::HandleMouseMove(const FGeometry& Geometry, const FPointerEvent& MouseEvent)
+{
+	FExampleInputLatencyTracker::StampInput();
+
+	if ( MouseMoveNative.IsBound() )
+	{
+		const FReply NativeReply = MouseMoveNative.Execute(Geometry, MouseEvent);
+		if ( NativeReply.IsEventHandled() )
+		{
+			return NativeReply;
+		}
+	}
+
+	if ( OnMouseMoveEvent.IsBound() )
+	{
+		return OnMouseMoveEvent.Execute(Geometry, MouseEvent).NativeReply;
+	}
+
+	return FReply::Unhandled();
+}
+
+FReply UExampleBorder::HandleMouseDoubleClick(const FGeometry& Geometry, const FPointerEvent& MouseEvent)
+{
+	FExampleInputLatencyTracker::StampInput();
+
+	if ( MouseDoubleClickNative.IsBound() )
+	{
+		const FReply NativeReply = MouseDoubleClickNative.Execute(Geometry, MouseEvent);
+		if ( NativeReply.IsEventHandled() )
+		{
+			return NativeReply;
+		}
+	}
+
+	if ( OnMouseDoubleClickEvent.IsBound() )
+	{
+		return OnMouseDoubleClickEvent.Execute(Geometry, MouseEvent).NativeReply;
+	}
+
+	return FReply::Unhandled();
+}
+
+void UExampleBorder::SetStyleId(FName InStyleId)
+{
+	UExampleBorderStyleRegistry* StyleRegistry = UExampleBorderStyleRegistry::Get();
+	if ( StyleRegistry )
+	{
+		StyleRegistry->UnregisterBorder(this);
+	}
+
+	// Whatever the old style set goes back to what it was before, the new style(if there is one) starts from our own values
+	const bool bWasStyled = RestoreUnstyledAppearance();
+
+	StyleId = InStyleId;
+	AppliedStyleGeneration = 0;
+
+	if ( StyleRegistry && MyBorder.IsValid() && !StyleId.IsNone() )
+	{
+		StyleRegistry->RegisterBorder(this);
+		StyleRegistry->ApplyStyleTo(this);
+	}
+
+	// If no style took over our slate widget is still showing the old one
+	if ( bWasStyled && !UnstyledAppearance.IsSet() && MyBorder.IsValid() )
+	{
+		UpdateSlateAppearance();
+	}
+}
+
+bool UExampleBorder::RestoreUnstyledAppearance()
+{
+	if ( !UnstyledAppearance.IsSet() )
+	{
+		return false;
+	}
+
+	BrushColor = UnstyledAppearance->BrushColor;
+	ContentColorAndOpacity = UnstyledAppearance->ContentColorAndOpacity;
+
+	// A soft brush that's still loading replaces the placeholder when it's done, that's the brush we'll be going back to
+	if ( !PendingBrushLoad.IsValid() )
+	{
+		SharedBackground = UnstyledAppearance->SharedBackground;
+	}
+
+	UnstyledAppearance.Reset();
+	AppliedStyleGeneration = 0;
+	return true;
+}
+
+void UExampleBorder::UpdateSlateAppearance()
+{
+	if ( BackgroundDelegate.IsBound() || BrushColorDelegate.IsBound() || ContentColorAndOpacityDelegate.IsBound() )
+	{
+		// Bindings win over the style, and SynchronizeProperties already knows how to set those up
+		SynchronizeProperties();
+	}
+	else
+	{
+		// Everything in one go so our slate widget only invalidates once
+		MyBorder->SetStyle(GetBackgroundBrush(), BrushColor, ContentColorAndOpacity);
+	}
+}
+
+void UExampleBorder::ApplyStyle(const FExampleBorderStyle& InStyle, const TSharedRef<const FSlateBrush>& InBrush, bool bUpdateSlateWidget)
+{
+	// Our view model has the final say over these values
+	if ( ViewModel )
+	{
+		return;
+	}
+
+	// Hang on to our own values the first time a style takes over, so we can go back to them when we leave it
+	if ( !UnstyledAppearance.IsSet() )
+	{
+		UnstyledAppearance = FUnstyledAppearance{ BrushColor, ContentColorAndOpacity, SharedBackground };
+	}
+
+	BrushColor = InStyle.BrushColor;
+	ContentColorAndOpacity = InStyle.ContentColorAndOpacity;
+	SetSharedBackground(InBrush);
+
+	if ( bUpdateSlateWidget && MyBorder.IsValid() )
+	{
+		UpdateSlateAppearance();
+	}
+}
+
+void UExampleBorder::SetViewModel(UExampleBorderViewModel* InViewModel)
+{
+	if ( ViewModel == InViewModel )
+	{
+		return;
+	}
+
+	// Stop listening to the old view model
+	if ( ViewModel )
+	{
+		ViewModel->OnFieldChanged().RemoveAll(this);
+	}
+
+	ViewModel = InViewModel;
+
+	// And start listening to the new one
+	if ( ViewModel )
+	{
+		ViewModel->OnFieldChanged().AddUObject(this, &UExampleBorder::HandleViewModelChanged);
+	}
+
+	// Either take the view model's values or go back to our bindings
+	if ( MyBorder.IsValid() )
+	{
+		SynchronizeProperties();
+	}
+}
+
+void UExampleBorder::HandleViewModelChanged(UExampleBorderViewModel* InViewModel, EExampleBorderViewModelField InField)
+{
+	// Only the value that changed gets pushed, and our setters take care of invalidating our slate widget
+	switch (InField)
+	{
+	case EExampleBorderViewModelField::BrushColor:
+		SetBrushColor(InViewModel->GetBrushColor());
+		break;
+	case EExampleBorderViewModelField::ContentColorAndOpacity:
+		SetContentColorAndOpacity(InViewModel->GetContentColorAndOpacity());
+		break;
+	case EExampleBorderViewModelField::Background:
+		// The view model's brush is shared by every border using it, our own Background stays as it was
+		SetSharedBackground(FExampleBrushPool::Get().Intern(InViewModel->GetBackground()));
+		if ( MyBorder.IsValid() )
+		{
+			MyBorder->SetBorderImage(GetBackgroundBrush());
+			MyBorder->SetInputStamp(FExampleInputLatencyTracker::GetPendingStamp());
+		}
+		break;
+	}
+}
+
+FSlateBrush UExampleBorder::GetBrush() const
+{
+	return *GetBackgroundBrush();
+}
+
+const FSlateBrush* UExampleBorder::GetBackgroundBrush() const
+{
+	return SharedBackground.IsValid() ? SharedBackground.Get() : &GetOwnBackground();
+}
+
+const FSlateBrush& UExampleBorder::GetOwnBackground() const
+{
+	return InternedBackground.IsValid() ? *InternedBackground : Background;
+}
+
+void UExampleBorder::InternBackground()
+{
+	// The designer edits Background in place, and a bound brush gets written into it every frame
+	if ( InternedBackground.IsValid() || IsDesignTime() || BackgroundDelegate.IsBound() )
+	{
+		return;
+	}
+
+	InternedBackground = FExampleBrushPool::Get().Intern(Background);
+	Background = FSlateBrush();
+}
+
+void UExampleBorder::SetSharedBackground(const TSharedRef<const FSlateBrush>& InBrush)
+{
+	// Background stays untouched, it's what Blueprints read and what we go back to once nothing's sharing a brush with us
+	SharedBackground = InBrush;
+}
+
+void UExampleBorder::MakeBackgroundUnique()
+{
+	// Copy-on-write, the shared brush is never modified so we take our own copy of it to change
+	if ( SharedBackground.IsValid() )
+	{
+		Background = *SharedBackground;
+		SharedBackground.Reset();
+		InternedBackground.Reset();
+	}
+	else if ( InternedBackground.IsValid() )
+	{
+		Background = *InternedBackground;
+		InternedBackground.Reset();
+	}
+}
+
+const FSlateBrush* UExampleBorder::ConvertImage(TAttribute<FSlateBrush> InImageAsset) const
+{
+	// Get a modifiable version of this
+	UExampleBorder* MutableThis = const_cast<UExampleBorder*>(this);
+	// Set its background at the same time
+	MutableThis->Background = InImageAsset.Get();
+
+	// Return that background
+	return &Background;
+}
+
+#undef LOCTEXT_NAMESPACE
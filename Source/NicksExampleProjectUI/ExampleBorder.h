@@ -0,0 +1,410 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ContentWidget.h"
+#include "Misc/Attribute.h"
+#include "Layout/Margin.h"
+#include "Styling/SlateBrush.h"
+#include "ExampleSyncScheduler.h"
+#include "ExampleBorder.generated.h"
+
+class SExampleBorder;
+class USlateBrushAsset;
+class UExampleBorderStyleRegistry;
+class UExampleBorderViewModel;
+struct FExampleBorderStyle;
+struct FStreamableHandle;
+enum class EExampleBorderViewModelField : uint8;
+
+/**
+ * 
+ */
+UCLASS()
+class NICKSEXAMPLEPROJECTUI_API UExampleBorder : public UContentWidget
+{
+	GENERATED_BODY()
+
+public:
+	
+	/** Constructor */
+	UExampleBorder();
+   
+    /** The alignment of the content horizontally. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Content")
+    TEnumAsByte<EHorizontalAlignment> HorizontalAlignment = HAlign_Fill;
+   
+    /** The alignment of the content vertically. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Content")
+    TEnumAsByte<EVerticalAlignment> VerticalAlignment = VAlign_Fill;
+   
+    /** Whether or not to show the disabled effect when this border is disabled */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Appearance, AdvancedDisplay)
+    uint8 bShowEffectWhenDisabled : 1;
+   
+    /** Color and opacity multiplier of content in the border */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Content", meta=( sRGB="true" ))
+    FLinearColor ContentColorAndOpacity = FLinearColor::White;
+   
+    /** A bindable delegate for the ContentColorAndOpacity. */
+    UPROPERTY()
+    FGetLinearColor ContentColorAndOpacityDelegate;
+   
+    /** The padding area between the slot and the content it contains. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Content")
+    FMargin Padding = FMargin(4, 2);
+   
+    /**
+     * Brush to drag as the background.
+     * At runtime our own brush gets interned(see FExampleBrushPool) and this is left empty, so borders built with the same brush
+     * share one copy of it. Blueprints read it through GetBrush, which returns the brush that's actually drawn, and it's put
+     * back in here whenever we get saved or copied. While our style, view model or a loading soft brush decides what we draw
+     * our own brush is left alone and we draw their shared brush instead.
+     */
+    UPROPERTY(EditAnywhere, BlueprintGetter=GetBrush, Category=Appearance, meta=( DisplayName="Brush" ))
+    FSlateBrush Background;
+   
+    /** A bindable delegate for the Brush. */
+    UPROPERTY()
+    FGetSlateBrush BackgroundDelegate;
+   
+    /** Color and opacity of the actual border image */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Appearance, meta=( sRGB="true" ))
+    FLinearColor BrushColor = FLinearColor::White;
+   
+    /** A bindable delegate for the BrushColor. */
+    UPROPERTY()
+    FGetLinearColor BrushColorDelegate;
+   
+    /**
+     * Scales the computed desired size of this border and its contents. Useful
+     * for making things that slide open without having to hard-code their size.
+     * Note: if the parent widget is set up to ignore this widget's desired size,
+     * then changing this value will have no effect.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance)
+    FVector2D DesiredSizeScale = FVector2D(1, 1);
+    
+    /**
+     * The ID of a style in the UExampleBorderStyleRegistry to take our brush, brush color and content color from.
+     * When the style changes(e.g. a theme swap) this border picks it up automatically, bindings still take priority over the style.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Appearance)
+    FName StyleId;
+
+    /**
+     * The view model we take our brush, brush color and content color from.
+     * Unlike the bindings above nothing gets called every frame, the view model tells us when one of its values changes
+     * and we only update then. While we have a view model it takes priority over the bindings and our style.
+     */
+    UPROPERTY(BlueprintReadOnly, Transient, Category=Appearance)
+    UExampleBorderViewModel* ViewModel = nullptr;
+
+    /**
+     * How soon our properties get pushed to our slate widget after being built or restyled. Anything other than Immediate
+     * lets the FExampleSyncScheduler spread the work over the next few frames, which is great for borders deep in a big menu.
+     * Our plain values(brush, colors, padding) show up right away either way, its bindings and events that may take a few frames.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Performance, AdvancedDisplay)
+    EExampleBorderSyncPriority SyncPriority = EExampleBorderSyncPriority::Immediate;
+
+    /**
+     * Whether or not our slate widget records what our content draws and reuses it every frame until something inside changes,
+     * see SExampleBorder::SetRetainContent. Turn it on for borders around big chunks of UI that rarely change.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Performance, AdvancedDisplay)
+    bool bRetainContent = false;
+
+    /**
+     * How many times a second the bound borders inside of us pick up their bindings, 0 means every frame like normal.
+     * Anything above 0 retains our content as well, see SExampleBorder::SetRefreshRate. Good for HUD frames bound to
+     * values that barely ever change, "ExampleUI.RefreshRate.Stats" shows how many refreshes it's been skipping.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Performance, AdvancedDisplay, meta=(ClampMin="0", UIMin="0"))
+    float RefreshRate = 0.0f;
+
+    /*************************DELEGATES***************************/
+    
+    UPROPERTY(EditAnywhere, Category=Events, meta=( IsBindableEvent="True" ))
+	FOnPointerEvent OnMouseButtonDownEvent;
+	
+	UPROPERTY(EditAnywhere, Category=Events, meta=( IsBindableEvent="True" ))
+	FOnPointerEvent OnMouseButtonUpEvent;
+	
+	UPROPERTY(EditAnywhere, Category=Events, meta=( IsBindableEvent="True" ))
+	FOnPointerEvent OnMouseMoveEvent;
+	
+	UPROPERTY(EditAnywhere, Category=Events, meta=( IsBindableEvent="True" ))
+	FOnPointerEvent OnMouseDoubleClickEvent;
+
+	/*************************END OF DELEGATES***************************/
+
+	/*************************NATIVE DELEGATES***************************/
+
+	// These are the C++ only versions of the events above, they aren't UPROPERTY's so binding to them skips the
+	// Blueprint VM and the UFunction parameter marshalling entirely (you can bind lambdas, raw, SP or UObject functions).
+	// If a native handler returns a handled reply then the Blueprint event for that input won't fire.
+	// Our slate widget only forwards the events somebody is listening to, getting one of these hooks it up.
+
+	/** Native version of OnMouseButtonDownEvent, for C++ owners. */
+	FPointerEventHandler& OnMouseButtonDownNative();
+
+	/** Native version of OnMouseButtonUpEvent, for C++ owners. */
+	FPointerEventHandler& OnMouseButtonUpNative();
+
+	/** Native version of OnMouseMoveEvent, for C++ owners. */
+	FPointerEventHandler& OnMouseMoveNative();
+
+	/** Native version of OnMouseDoubleClickEvent, for C++ owners. */
+	FPointerEventHandler& OnMouseDoubleClickNative();
+
+	/*************************END OF NATIVE DELEGATES***************************/
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetContentColorAndOpacity(FLinearColor InContentColorAndOpacity);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetPadding(FMargin InPadding);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetVerticalAlignment(EVerticalAlignment InVerticalAlignment);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetBrushColor(FLinearColor InBrushColor);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetBrush(const FSlateBrush& InBrush);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetBrushFromAsset(USlateBrushAsset* InAsset);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetBrushFromTexture(UTexture2D* InTexture);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    void SetBrushFromMaterial(UMaterialInterface* InMaterial);
+
+	/**
+	 * These are the same as the setters above but take soft references, so nothing has to be loaded up front.
+	 * If it's not loaded yet it gets streamed in the background while we draw a placeholder(a plain dark box every border shares),
+	 * then swapped in with a single repaint.
+	 * Setting another brush while one is loading cancels the load.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+	void SetBrushFromSoftAsset(TSoftObjectPtr<USlateBrushAsset> InAsset);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+	void SetBrushFromSoftTexture(TSoftObjectPtr<UTexture2D> InTexture);
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+	void SetBrushFromSoftMaterial(TSoftObjectPtr<UMaterialInterface> InMaterial);
+
+	/** Whether or not we're drawing the loading placeholder while a soft brush streams in */
+	UFUNCTION(BlueprintPure, Category="Appearance")
+	bool IsLoadingBrush() const { return PendingBrushLoad.IsValid(); }
+
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+    UMaterialInstanceDynamic* GetDynamicMaterial();
+
+	/** Switches this border over to another style from the UExampleBorderStyleRegistry, None stops using styles */
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+	void SetStyleId(FName InStyleId);
+
+	/** Starts(or stops, if null) taking our appearance from the given view model */
+	UFUNCTION(BlueprintCallable, Category="Appearance")
+	void SetViewModel(UExampleBorderViewModel* InViewModel);
+
+	/** Returns the brush that's drawn as the background, whether it's a shared one or our own */
+	UFUNCTION(BlueprintPure, Category="Appearance")
+	FSlateBrush GetBrush() const;
+
+	/** See bRetainContent */
+	UFUNCTION(BlueprintCallable, Category="Performance")
+	void SetRetainContent(bool bInRetainContent);
+
+	/** See RefreshRate */
+	UFUNCTION(BlueprintCallable, Category="Performance")
+	void SetRefreshRate(float InRefreshRate);
+
+	/**
+	* Sets the DesireSizeScale of this border.
+	*
+	* @param InScale    The X and Y multipliers for the desired size
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Appearance")
+    void SetDesiredSizeScale(FVector2D InScale);
+
+	//~ Begin UWidget Interface	
+	/** Here we bind our delegates and properties to the slate widget(or leave it to the FExampleSyncScheduler, see SyncPriority) */
+	virtual void SynchronizeProperties() override;
+	//~ End UWidget Interface
+
+	/** Whether or not we're waiting on the FExampleSyncScheduler to synchronize us */
+	bool IsSyncPending() const { return bSyncPending; }
+
+	//~ Begin UVisual Interface	
+	/** Here we reset the slate widget also if its not pointed to by any other classes, garbage collected */
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+	//~ End UVisual Interface
+
+	//~ Begin UObject Interface
+	/** Here we handle any deprecations(not needed in our case) and telling our slot to update */
+	virtual void PostLoad() override;
+	/** Stops waiting on any soft brush(there'll be nobody to hand it to) and lets go of our pooled brushes */
+	virtual void BeginDestroy() override;
+	/** Puts our interned brush back in Background for anything saving or copying us */
+	virtual void Serialize(FArchive& Ar) override;
+	//~ End UObject Interface
+
+// These are editor only inherited functions
+#if WITH_EDITOR
+	
+	//~ Begin UObject Interface
+	/**
+	 * Here we are keeping everything in sync with our slot the same way we did in our slot class.
+	 * Simple property edits get patched straight into our slate widget(see PatchDesignerProperty), only anything else resynchronizes all of our properties.
+	 * The widget blueprint editor still rebuilds its whole preview once the details panel marks the blueprint as modified, which we can't stop,
+	 * so when that happens each border takes back the slate widget it had in the last preview(see RebuildWidget and "ExampleUI.Designer.Stats").
+	 */
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	//~ End UObject Interface
+
+	/** This is just for cosmetic's but it is required, the category of where to place this widget in the palette list */
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+
+#if WITH_EDITOR
+	/**
+	 * Pushes a single edited property to our slate widget through the same setters we use at runtime, so a tweak in the designer
+	 * only invalidates what that property affects. Returns false if the property isn't one we can patch(bindings, events, anything
+	 * a style or view model decides for us), in which case everything needs synchronizing.
+	 */
+	bool PatchDesignerProperty(FName PropertyName);
+
+	/** Set while UWidget::PostEditChangeProperty runs, so its resynchronize of everything gets left to us(see PostEditChangeProperty) */
+	bool bDeferDesignerSynchronize = false;
+#endif
+
+	// UPanelWidget
+	virtual UClass* GetSlotClass() const override;
+	virtual void OnSlotAdded(UPanelSlot* InSlot) override;
+	virtual void OnSlotRemoved(UPanelSlot* InSlot) override;
+	// End UPanelWidget
+
+	//~ Begin UWidget Interface
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	//~ End UWidget Interface
+	
+	FReply HandleMouseButtonDown(const FGeometry& Geometry, const FPointerEvent& MouseEvent);
+	FReply HandleMouseButtonUp(const FGeometry& Geometry, const FPointerEvent& MouseEvent);
+	FReply HandleMouseMove(const FGeometry& Geometry, const FPointerEvent& MouseEvent);
+	FReply HandleMouseDoubleClick(const FGeometry& Geometry, const FPointerEvent& MouseEvent);
+
+	/** Called by our view model when one of its values changes, pushes just that value to our slate widget */
+	void HandleViewModelChanged(UExampleBorderViewModel* InViewModel, EExampleBorderViewModelField InField);
+
+	/** The brush we draw, the shared one if we have it otherwise our own */
+	const FSlateBrush* GetBackgroundBrush() const;
+
+	/** Our own brush, whether it's interned or still in Background */
+	const FSlateBrush& GetOwnBackground() const;
+
+	/** Swaps our own brush in Background for the pooled copy of it, every border built from the same widget blueprint has the same one */
+	void InternBackground();
+
+	/** Starts drawing the given pooled brush instead of our own Background, which is left as it is */
+	void SetSharedBackground(const TSharedRef<const FSlateBrush>& InBrush);
+
+	/** If we're drawing a shared(or interned) brush this copies it into Background(and stops sharing) so we can change it without affecting anyone else */
+	void MakeBackgroundUnique();
+
+	/**
+	 * Calls ApplyLoaded with the object once it's loaded, straight away if it already is. Otherwise we draw the loading placeholder
+	 * until it's been streamed in. ApplyLoaded gets null if the path is empty or the object couldn't be loaded.
+	 */
+	void LoadBrushAsync(const FSoftObjectPath& InPath, TFunction<void(UObject*)>&& ApplyLoaded);
+
+	/** Stops waiting on a soft brush, whatever's being set instead wins. With bRestoreBrush we go back to drawing what we had before the placeholder */
+	void CancelBrushLoad(bool bRestoreBrush = false);
+
+	/** The brush we had before the loading placeholder went in, soft textures/materials get set on this rather than the placeholder */
+	const FSlateBrush& GetBrushIgnoringLoading() const;
+
+	// A soft brush we're streaming in
+	struct FPendingBrushLoad
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+
+		// The shared brush we were drawing before the placeholder went in, null if it was our own brush(which loading never touches)
+		TSharedPtr<const FSlateBrush> SharedBackgroundBeforeLoading;
+	};
+
+	// Only exists while we're waiting on a soft brush, most borders never do
+	TUniquePtr<FPendingBrushLoad> PendingBrushLoad;
+
+	/** Translates the bound brush data and assigns it to the cached brush used by this widget. */
+	const FSlateBrush* ConvertImage(TAttribute<FSlateBrush> InImageAsset) const;
+	
+	// Our slate pointer
+	TSharedPtr<SExampleBorder> MyBorder;
+
+	// The pooled brush our style, view model or loading placeholder has us drawing, null when we're drawing our own brush
+	TSharedPtr<const FSlateBrush> SharedBackground;
+
+	// Our own brush once it's been interned, Background is empty while this is set so it isn't a second copy of the brush
+	TSharedPtr<const FSlateBrush> InternedBackground;
+
+	// Our native pointer event handlers, see the accessors above
+	FPointerEventHandler MouseButtonDownNative;
+	FPointerEventHandler MouseButtonUpNative;
+	FPointerEventHandler MouseMoveNative;
+	FPointerEventHandler MouseDoubleClickNative;
+
+	/** Pushes our properties, bindings and events to our slate widget, this is the actual work of SynchronizeProperties */
+	void SynchronizeBorder();
+
+	// The sync scheduler is what calls RunDeferredSync and keeps track of bSyncPending
+	friend class FExampleSyncScheduler;
+
+	/** Does the synchronization we put off, including our slot's which waits on us */
+	void RunDeferredSync();
+
+	// True while we're queued up in the FExampleSyncScheduler
+	bool bSyncPending = false;
+
+	// The style registry applies styles to us and keeps track of which version we have
+	friend UExampleBorderStyleRegistry;
+
+	/** Takes on the given style, and updates our slate widget(with a single invalidation) if asked to */
+	void ApplyStyle(const FExampleBorderStyle& InStyle, const TSharedRef<const FSlateBrush>& InBrush, bool bUpdateSlateWidget);
+
+	/** Puts back our own brush and colors from before we took on a style, returns false if we didn't have a style to begin with */
+	bool RestoreUnstyledAppearance();
+
+	/** Pushes our brush and colors to our slate widget with a single invalidation(or resynchronizes if any of them are bound) */
+	void UpdateSlateAppearance();
+
+	// The style generation we last applied, so we don't apply the same version of a style twice
+	uint32 AppliedStyleGeneration = 0;
+
+	// The style ID the registry has us filed under, None if we aren't registered. Only the registry changes this
+	FName RegisteredStyleId;
+
+	// What we looked like before a style took over, kept up to date by our setters so leaving the style puts back our latest values
+	struct FUnstyledAppearance
+	{
+		FLinearColor BrushColor;
+		FLinearColor ContentColorAndOpacity;
+		TSharedPtr<const FSlateBrush> SharedBackground;
+	};
+	TOptional<FUnstyledAppearance> UnstyledAppearance;
+
+	// Declare that we're gonna implement a property binding between the slate widget and this value
+	PROPERTY_BINDING_IMPLEMENTATION(FLinearColor, ContentColorAndOpacity)	
+};
@@ -26,6 +26,13 @@ void UExampleBorderSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlign
 
 void UExampleBorderSlot::SynchronizeProperties()
 {
+	// If our border's synchronization got deferred then so does ours, it'll synchronize us when it gets around to itself
+	const UExampleBorder* ParentBorder = Cast<UExampleBorder>(Parent);
+	if ( ParentBorder && ParentBorder->IsSyncPending() )
+	{
+		return;
+	}
+
 	// If the slate pointer is valid
 	if ( Border.IsValid() )
 	{
@@ -85,18 +92,22 @@ void UExampleBorderSlot::PostEditChangeProperty(FPropertyChangedEvent& PropertyC
 			if (UExampleBorder* ParentBorder = CastChecked<UExampleBorder>(Parent))
 			{
 				// Check for if the property changed was something we need to account for
-				// MigratePropertyValue basically copying data between our parent widget and this object to keep them in sync for certain values while in editor
+				// MigratePropertyValue basically copying data between our parent widget and this object to keep them in sync for certain values while in editor.
+				// Then we patch the value straight into the live slate border through our setters, so the designer only has to repaint/relayout that one border
 				if (PropertyName == PaddingName)
 				{
 					FObjectEditorUtils::MigratePropertyValue(this, PaddingName, ParentBorder, PaddingName);
+					SetPadding(Padding);
 				}
 				else if (PropertyName == HorizontalAlignmentName)
 				{
 					FObjectEditorUtils::MigratePropertyValue(this, HorizontalAlignmentName, ParentBorder, HorizontalAlignmentName);
+					SetHorizontalAlignment(HorizontalAlignment);
 				}
 				else if (PropertyName == VerticalAlignmentName)
 				{
 					FObjectEditorUtils::MigratePropertyValue(this, VerticalAlignmentName, ParentBorder, VerticalAlignmentName);
+					SetVerticalAlignment(VerticalAlignment);
 				}
 			}
 		}
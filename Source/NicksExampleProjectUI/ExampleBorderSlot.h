@@ -14,7 +14,7 @@ class UExampleBorder;
  * 
  */
 UCLASS()
-class NICKSEXAMPLEPROJECT_API UExampleBorderSlot : public UPanelSlot
+class NICKSEXAMPLEPROJECTUI_API UExampleBorderSlot : public UPanelSlot
 {
 	GENERATED_BODY()	
 	
@@ -28,6 +28,10 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category="Layout|Border Slot")
     void SetVerticalAlignment(EVerticalAlignment InVerticalAlignment);
+
+	FMargin GetPadding() const { return Padding; }
+	EHorizontalAlignment GetHorizontalAlignment() const { return HorizontalAlignment; }
+	EVerticalAlignment GetVerticalAlignment() const { return VerticalAlignment; }
 	
 	// UPanelSlot interface
 	/** This is basically the visuals if the slate widget pointer is valid */
@@ -0,0 +1,125 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleBorderStyleRegistry.h"
+#include "ExampleBorder.h"
+#include "ExampleBrushPool.h"
+#include "Engine/Engine.h"
+
+UExampleBorderStyleRegistry* UExampleBorderStyleRegistry::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UExampleBorderStyleRegistry>() : nullptr;
+}
+
+const FExampleBorderStyle* UExampleBorderStyleRegistry::FindStyle(FName StyleId, TSharedPtr<const FSlateBrush>* OutBrush) const
+{
+	const FStyleEntry* Entry = Styles.Find(StyleId);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	if (OutBrush)
+	{
+		*OutBrush = Entry->Brush;
+	}
+	return &Entry->Style;
+}
+
+void UExampleBorderStyleRegistry::SetStyle(FName StyleId, const FExampleBorderStyle& Style)
+{
+	TMap<FName, FExampleBorderStyle> Theme;
+	Theme.Add(StyleId, Style);
+	ApplyTheme(Theme);
+}
+
+void UExampleBorderStyleRegistry::ApplyTheme(const TMap<FName, FExampleBorderStyle>& Theme)
+{
+	// One generation for the whole theme no matter how many styles are in it
+	++Generation;
+
+	TArray<FName> ChangedStyles;
+	for (const TPair<FName, FExampleBorderStyle>& Pair : Theme)
+	{
+		FStyleEntry& Entry = Styles.FindOrAdd(Pair.Key);
+		Entry.Style = Pair.Value;
+		Entry.Brush = FExampleBrushPool::Get().Intern(Pair.Value.Brush);
+		Entry.Generation = Generation;
+		ChangedStyles.Add(Pair.Key);
+	}
+
+	RefreshBorders(ChangedStyles);
+}
+
+void UExampleBorderStyleRegistry::ApplyStyleTo(UExampleBorder* Border, bool bUpdateSlateWidget)
+{
+	const FStyleEntry* Entry = Border ? Styles.Find(Border->StyleId) : nullptr;
+
+	// Nothing to do if the style doesn't exist or the border already has this version of it
+	if (Entry && Border->AppliedStyleGeneration != Entry->Generation)
+	{
+		Border->AppliedStyleGeneration = Entry->Generation;
+		Border->ApplyStyle(Entry->Style, Entry->Brush.ToSharedRef(), bUpdateSlateWidget);
+	}
+}
+
+void UExampleBorderStyleRegistry::RegisterBorder(UExampleBorder* Border)
+{
+	if (!Border || Border->RegisteredStyleId == Border->StyleId)
+	{
+		return;
+	}
+
+	// Filed under an old style ID, move it over
+	UnregisterBorder(Border);
+	if (!Border->StyleId.IsNone())
+	{
+		BordersByStyle.FindOrAdd(Border->StyleId).Add(Border);
+		Border->RegisteredStyleId = Border->StyleId;
+
+		// Two styles changed in the same theme share a generation, so make sure the new one doesn't look like it's already applied
+		Border->AppliedStyleGeneration = 0;
+	}
+}
+
+void UExampleBorderStyleRegistry::UnregisterBorder(UExampleBorder* Border)
+{
+	if (!Border || Border->RegisteredStyleId.IsNone())
+	{
+		return;
+	}
+
+	// The border might have changed its style ID since it registered, but it remembers which one it's filed under
+	if (TSet<TWeakObjectPtr<UExampleBorder>>* Borders = BordersByStyle.Find(Border->RegisteredStyleId))
+	{
+		Borders->Remove(Border);
+	}
+	Border->RegisteredStyleId = NAME_None;
+}
+
+void UExampleBorderStyleRegistry::RefreshBorders(const TArray<FName>& ChangedStyles)
+{
+	for (const FName& StyleId : ChangedStyles)
+	{
+		TSet<TWeakObjectPtr<UExampleBorder>>* Borders = BordersByStyle.Find(StyleId);
+		if (!Borders)
+		{
+			continue;
+		}
+
+		for (TSet<TWeakObjectPtr<UExampleBorder>>::TIterator It(*Borders); It; ++It)
+		{
+			UExampleBorder* Border = It->Get();
+
+			// Get rid of borders that are gone, the rest move themselves over when they change style
+			if (!Border)
+			{
+				It.RemoveCurrent();
+			}
+			else if (Border->StyleId == StyleId)
+			{
+				ApplyStyleTo(Border);
+			}
+		}
+	}
+}
@@ -0,0 +1,99 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "ExampleBorderStyleRegistry.generated.h"
+
+class UExampleBorder;
+
+/** The look of a border that can be shared by any number of borders through their StyleId */
+USTRUCT(BlueprintType)
+struct NICKSEXAMPLEPROJECTUI_API FExampleBorderStyle
+{
+	GENERATED_BODY()
+
+	/** Brush to draw as the background */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Style")
+	FSlateBrush Brush;
+
+	/** Color and opacity of the actual border image */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Style", meta = ( sRGB = "true" ))
+	FLinearColor BrushColor = FLinearColor::White;
+
+	/** Color and opacity multiplier of content in the border */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Style", meta = ( sRGB = "true" ))
+	FLinearColor ContentColorAndOpacity = FLinearColor::White;
+};
+
+/**
+ * Holds the border styles that borders reference by ID, so restyling(theme or colorblind toggles for example) doesn't mean
+ * calling setters on every border one by one.
+ * Every change bumps a generation counter and all of the borders using the changed styles get updated in a single pass,
+ * with only one invalidation per border.
+ */
+UCLASS()
+class NICKSEXAMPLEPROJECTUI_API UExampleBorderStyleRegistry : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Shortcut to get the registry from the engine, can be null before the engine is up */
+	static UExampleBorderStyleRegistry* Get();
+
+	/** Adds or replaces a single style, every border using it gets updated straight away */
+	UFUNCTION(BlueprintCallable, Category = "Example Border Style")
+	void SetStyle(FName StyleId, const FExampleBorderStyle& Style);
+
+	/** Adds or replaces a whole set of styles at once, every affected border gets updated exactly once */
+	UFUNCTION(BlueprintCallable, Category = "Example Border Style")
+	void ApplyTheme(const TMap<FName, FExampleBorderStyle>& Theme);
+
+	/** Whether or not there's a style with this ID */
+	UFUNCTION(BlueprintPure, Category = "Example Border Style")
+	bool HasStyle(FName StyleId) const { return Styles.Contains(StyleId); }
+
+	/** Looks up a style, along with its pooled brush if OutBrush is given. Returns null if there's no style with that ID */
+	const FExampleBorderStyle* FindStyle(FName StyleId, TSharedPtr<const FSlateBrush>* OutBrush = nullptr) const;
+
+	/** Goes up by one every time any style changes */
+	uint32 GetGeneration() const { return Generation; }
+
+	/**
+	 * Applies the current version of the border's style to it, if it hasn't got it already.
+	 * Borders call this themselves when they synchronize their properties, in which case they'll update their slate widget anyway.
+	 */
+	void ApplyStyleTo(UExampleBorder* Border, bool bUpdateSlateWidget = true);
+
+	/**
+	 * Borders register themselves while they have a slate widget so they can be found when their style changes.
+	 * Each border remembers the style it's filed under, so both of these only ever touch that one style's borders
+	 */
+	void RegisterBorder(UExampleBorder* Border);
+	void UnregisterBorder(UExampleBorder* Border);
+
+private:
+
+	struct FStyleEntry
+	{
+		FExampleBorderStyle Style;
+
+		/** The style's brush, pooled so every border using this style shares it */
+		TSharedPtr<const FSlateBrush> Brush;
+
+		/** The generation this style was last changed in */
+		uint32 Generation = 0;
+	};
+
+	/** Updates every registered border that uses one of the given styles */
+	void RefreshBorders(const TArray<FName>& ChangedStyles);
+
+	TMap<FName, FStyleEntry> Styles;
+	/** Sets rather than arrays so tearing down a screen full of borders doesn't search the whole style for each one */
+	TMap<FName, TSet<TWeakObjectPtr<UExampleBorder>>> BordersByStyle;
+
+	uint32 Generation = 0;
+};
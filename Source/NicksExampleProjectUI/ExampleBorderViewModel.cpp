@@ -0,0 +1,32 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleBorderViewModel.h"
+
+void UExampleBorderViewModel::SetBrushColor(FLinearColor InBrushColor)
+{
+	// Only tell anyone if the value really changed, that's the whole point of pushing changes
+	if (BrushColor != InBrushColor)
+	{
+		BrushColor = InBrushColor;
+		FieldChanged.Broadcast(this, EExampleBorderViewModelField::BrushColor);
+	}
+}
+
+void UExampleBorderViewModel::SetContentColorAndOpacity(FLinearColor InContentColorAndOpacity)
+{
+	if (ContentColorAndOpacity != InContentColorAndOpacity)
+	{
+		ContentColorAndOpacity = InContentColorAndOpacity;
+		FieldChanged.Broadcast(this, EExampleBorderViewModelField::ContentColorAndOpacity);
+	}
+}
+
+void UExampleBorderViewModel::SetBackground(const FSlateBrush& InBackground)
+{
+	if (Background != InBackground)
+	{
+		Background = InBackground;
+		FieldChanged.Broadcast(this, EExampleBorderViewModelField::Background);
+	}
+}
@@ -0,0 +1,71 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Styling/SlateBrush.h"
+#include "ExampleBorderViewModel.generated.h"
+
+/** The fields of a border view model, used to tell listeners which one changed */
+UENUM(BlueprintType)
+enum class EExampleBorderViewModelField : uint8
+{
+	BrushColor,
+	ContentColorAndOpacity,
+	Background,
+};
+
+class UExampleBorderViewModel;
+
+/** Fired whenever one of the view model's fields actually changes value */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnExampleBorderViewModelChanged, UExampleBorderViewModel* /*ViewModel*/, EExampleBorderViewModelField /*Field*/);
+
+/**
+ * Holds the values a border displays and tells the borders using it when they change.
+ * This is the push alternative to binding BrushColorDelegate/BackgroundDelegate...etc, which slate has to call every frame
+ * whether the value changed or not. Borders using a view model only do work when a value really changes.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class NICKSEXAMPLEPROJECTUI_API UExampleBorderViewModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, Category = "Example Border View Model")
+	void SetBrushColor(FLinearColor InBrushColor);
+
+	UFUNCTION(BlueprintPure, Category = "Example Border View Model")
+	FLinearColor GetBrushColor() const { return BrushColor; }
+
+	UFUNCTION(BlueprintCallable, Category = "Example Border View Model")
+	void SetContentColorAndOpacity(FLinearColor InContentColorAndOpacity);
+
+	UFUNCTION(BlueprintPure, Category = "Example Border View Model")
+	FLinearColor GetContentColorAndOpacity() const { return ContentColorAndOpacity; }
+
+	UFUNCTION(BlueprintCallable, Category = "Example Border View Model")
+	void SetBackground(const FSlateBrush& InBackground);
+
+	UFUNCTION(BlueprintPure, Category = "Example Border View Model")
+	FSlateBrush GetBackground() const { return Background; }
+
+	/** Native listeners(like our borders) subscribe to this to be told about changes */
+	FOnExampleBorderViewModelChanged& OnFieldChanged() { return FieldChanged; }
+
+protected:
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Example Border View Model", meta = ( sRGB = "true" ))
+	FLinearColor BrushColor = FLinearColor::White;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Example Border View Model", meta = ( sRGB = "true" ))
+	FLinearColor ContentColorAndOpacity = FLinearColor::White;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Example Border View Model")
+	FSlateBrush Background;
+
+private:
+
+	FOnExampleBorderViewModelChanged FieldChanged;
+};
@@ -0,0 +1,144 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleBrushPool.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithOutputDevice ExampleBrushPoolStatsCommand(
+	TEXT("ExampleUI.BrushPool.Stats"),
+	TEXT("Prints how many brushes are shared through the example brush pool and how much memory it takes up."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		FExampleBrushPool::Get().DumpStats(Ar);
+	}));
+
+/** Pooled brushes can outlive the pool at shutdown(function statics holding on to one), they only tell it they're gone while it's still around */
+static bool GExampleBrushPoolDestroyed = false;
+
+FExampleBrushPool& FExampleBrushPool::Get()
+{
+	static FExampleBrushPool Instance;
+	return Instance;
+}
+
+FExampleBrushPool::~FExampleBrushPool()
+{
+	GExampleBrushPoolDestroyed = true;
+}
+
+TSharedRef<const FSlateBrush> FExampleBrushPool::Intern(const FSlateBrush& InBrush)
+{
+	TArray<FPooledBrush>& Bucket = Brushes.FindOrAdd(HashBrush(InBrush));
+
+	for (const FPooledBrush& Pooled : Bucket)
+	{
+		if (TSharedPtr<const FSlateBrush> Existing = Pooled.WeakBrush.Pin())
+		{
+			if (*Existing == InBrush)
+			{
+				return Existing.ToSharedRef();
+			}
+		}
+	}
+
+	// The brush leaves the pool the moment nobody uses it anymore, rather than its entry hanging around until someone tidies up
+	TSharedRef<FSlateBrush> NewBrush = MakeShareable(new FSlateBrush(InBrush), [](FSlateBrush* Brush)
+	{
+		if (!GExampleBrushPoolDestroyed)
+		{
+			FExampleBrushPool::Get().Release(Brush);
+		}
+		delete Brush;
+	});
+	Bucket.Add(FPooledBrush{ &NewBrush.Get(), NewBrush });
+	return NewBrush;
+}
+
+void FExampleBrushPool::Release(const FSlateBrush* InBrush)
+{
+	// The brush is still intact at this point, so it hashes to the same bucket it went into
+	const uint32 Hash = HashBrush(*InBrush);
+	if (TArray<FPooledBrush>* Bucket = Brushes.Find(Hash))
+	{
+		Bucket->RemoveAllSwap([InBrush](const FPooledBrush& Pooled) { return Pooled.Brush == InBrush; });
+		if (Bucket->Num() == 0)
+		{
+			Brushes.Remove(Hash);
+		}
+	}
+}
+
+int32 FExampleBrushPool::GetNumUniqueBrushes() const
+{
+	int32 NumUnique = 0;
+	for (const TPair<uint32, TArray<FPooledBrush>>& Pair : Brushes)
+	{
+		NumUnique += Pair.Value.Num();
+	}
+	return NumUnique;
+}
+
+int32 FExampleBrushPool::GetNumReferences() const
+{
+	int32 NumReferences = 0;
+	for (const TPair<uint32, TArray<FPooledBrush>>& Pair : Brushes)
+	{
+		for (const FPooledBrush& Pooled : Pair.Value)
+		{
+			if (TSharedPtr<const FSlateBrush> Pinned = Pooled.WeakBrush.Pin())
+			{
+				// Don't count the reference we just made by pinning it
+				NumReferences += Pinned.GetSharedReferenceCount() - 1;
+			}
+		}
+	}
+	return NumReferences;
+}
+
+SIZE_T FExampleBrushPool::GetAllocatedSize() const
+{
+	// The buckets themselves, plus every brush in them
+	SIZE_T Size = Brushes.GetAllocatedSize();
+	for (const TPair<uint32, TArray<FPooledBrush>>& Pair : Brushes)
+	{
+		Size += Pair.Value.GetAllocatedSize() + Pair.Value.Num() * sizeof(FSlateBrush);
+	}
+	return Size;
+}
+
+void FExampleBrushPool::DumpStats(FOutputDevice& Ar) const
+{
+	const int32 NumUnique = GetNumUniqueBrushes();
+	const int32 NumReferences = GetNumReferences();
+
+	Ar.Logf(TEXT("Example brush pool: %d unique brushes, %d references(%.1f per brush)"),
+		NumUnique, NumReferences, NumUnique > 0 ? float(NumReferences) / NumUnique : 0.0f);
+	Ar.Logf(TEXT("  %llu bytes in use, %d bytes per brush"), uint64(GetAllocatedSize()), int32(sizeof(FSlateBrush)));
+}
+
+void FExampleBrushPool::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (const TPair<uint32, TArray<FPooledBrush>>& Pair : Brushes)
+	{
+		for (const FPooledBrush& Pooled : Pair.Value)
+		{
+			if (TSharedPtr<const FSlateBrush> Pinned = Pooled.WeakBrush.Pin())
+			{
+				UObject* ResourceObject = Pinned->GetResourceObject();
+				Collector.AddReferencedObject(ResourceObject);
+			}
+		}
+	}
+}
+
+uint32 FExampleBrushPool::HashBrush(const FSlateBrush& InBrush)
+{
+	uint32 Hash = GetTypeHash(InBrush.ImageSize);
+	Hash = HashCombine(Hash, GetTypeHash(InBrush.GetResourceObject()));
+	Hash = HashCombine(Hash, GetTypeHash(InBrush.GetResourceName()));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(InBrush.DrawAs.GetValue())));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(InBrush.Tiling.GetValue())));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(InBrush.Mirroring.GetValue())));
+	Hash = HashCombine(Hash, GetTypeHash(InBrush.TintColor.GetSpecifiedColor()));
+	return Hash;
+}
@@ -0,0 +1,63 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+#include "UObject/GCObject.h"
+
+/**
+ * Interns slate brushes so that everything drawing an identical brush(borders built with the same Background, a border style,
+ * a view model, a compact border tree, the soft brush loading placeholder) points at one shared, immutable instance.
+ *
+ * The pool only keeps weak references, a brush takes itself back out of the pool as soon as the last border using it lets go.
+ * Anything that wants to change a pooled brush has to copy it first(copy-on-write), the pooled instance is never modified.
+ * Game thread only.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleBrushPool : public FGCObject
+{
+public:
+
+	static FExampleBrushPool& Get();
+
+	virtual ~FExampleBrushPool();
+
+	/** Returns the shared instance of a brush that's identical to InBrush, adding it to the pool if there isn't one yet */
+	TSharedRef<const FSlateBrush> Intern(const FSlateBrush& InBrush);
+
+	/** How many distinct brushes are currently alive in the pool */
+	int32 GetNumUniqueBrushes() const;
+
+	/** How many references there are to pooled brushes */
+	int32 GetNumReferences() const;
+
+	/** How many bytes the pooled brushes and the pool's own bookkeeping take up */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Prints what's in the pool and the memory it takes up */
+	void DumpStats(FOutputDevice& Ar) const;
+
+	//~ Begin FGCObject Interface
+	/** The pooled brushes aren't UPROPERTY's anywhere so we keep their textures/materials alive ourselves */
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FExampleBrushPool"); }
+	//~ End FGCObject Interface
+
+private:
+
+	/** Hashes the parts of a brush that operator== compares */
+	static uint32 HashBrush(const FSlateBrush& InBrush);
+
+	/** Called by a pooled brush as its last reference goes away, before it gets deleted */
+	void Release(const FSlateBrush* InBrush);
+
+	struct FPooledBrush
+	{
+		// Only for finding our entry once the brush is on its way out, by then the weak pointer can't be pinned anymore
+		const FSlateBrush* Brush;
+		TWeakPtr<const FSlateBrush> WeakBrush;
+	};
+
+	/** Brushes bucketed by their hash, weak so the pool doesn't keep brushes alive on its own */
+	TMap<uint32, TArray<FPooledBrush>> Brushes;
+};
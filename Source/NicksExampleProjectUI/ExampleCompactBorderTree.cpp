@@ -0,0 +1,421 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleCompactBorderTree.h"
+#include "Async/MappedFileHandle.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ExampleBorder.h"
+#include "ExampleBorderSlot.h"
+#include "ExampleBrushPool.h"
+#include "SExampleBorder.h"
+
+namespace ExampleCompactBorderTree
+{
+	/** "EXBT" */
+	static const uint32 FileMagic = 0x54425845;
+	static const uint32 FileVersion = 1;
+
+	/**
+	 * The file is these laid out one after another, all of them plain data read straight out of the mapped file:
+	 * FHeader, FNode[NumNodes], int32 Roots[NumRoots], FBrush[NumBrushes], then NumStringBytes of UTF-8 strings.
+	 * Everything's a multiple of 4 bytes so every part stays aligned.
+	 */
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		int32 NumNodes;
+		int32 NumRoots;
+		int32 NumBrushes;
+		int32 NumStringBytes;
+	};
+
+	/** One border. Nodes are written outermost first, so a border's content always comes after it */
+	struct FNode
+	{
+		FLinearColor BrushColor;
+		FLinearColor ContentColorAndOpacity;
+		FMargin Padding;
+		FVector2D DesiredSizeScale;
+
+		/** Index into the brushes, or INDEX_NONE to draw nothing */
+		int32 BrushIndex;
+
+		/** Index of the border inside of this one, or INDEX_NONE if it's empty */
+		int32 ContentIndex;
+
+		uint8 HorizontalAlignment;
+		uint8 VerticalAlignment;
+		uint8 bShowEffectWhenDisabled;
+		uint8 Unused;
+	};
+
+	/** How a brush's tint is picked, FSlateColor keeps this to itself so we work it out when cooking */
+	enum class ETintRule : uint8
+	{
+		Specified,
+		Foreground,
+		SubduedForeground,
+	};
+
+	/** One brush, borders that used identical brushes all share one of these */
+	struct FBrush
+	{
+		FLinearColor Tint;
+		FMargin Margin;
+		FVector2D ImageSize;
+
+		/** Offset into the strings of the path to the brush's texture/material, or INDEX_NONE if it hasn't got one */
+		int32 ResourcePathOffset;
+
+		uint8 DrawAs;
+		uint8 Tiling;
+		uint8 Mirroring;
+		uint8 ImageType;
+		uint8 TintRule;
+		uint8 Unused[3];
+	};
+
+	static_assert(sizeof(FHeader) % 4 == 0 && sizeof(FNode) % 4 == 0 && sizeof(FBrush) % 4 == 0, "Compact border tree parts have to stay 4 byte aligned");
+
+	/** Where each part of the file starts, worked out from the header */
+	static int64 GetNodesOffset() { return sizeof(FHeader); }
+	static int64 GetRootsOffset(const FHeader& Header) { return GetNodesOffset() + int64(Header.NumNodes) * sizeof(FNode); }
+	static int64 GetBrushesOffset(const FHeader& Header) { return GetRootsOffset(Header) + int64(Header.NumRoots) * sizeof(int32); }
+	static int64 GetStringsOffset(const FHeader& Header) { return GetBrushesOffset(Header) + int64(Header.NumBrushes) * sizeof(FBrush); }
+
+	static FBrush MakeBrush(const FSlateBrush& InBrush, TArray<ANSICHAR>& Strings)
+	{
+		FBrush Brush;
+		FMemory::Memzero(Brush);
+
+		Brush.Tint = InBrush.TintColor.IsColorSpecified() ? InBrush.TintColor.GetSpecifiedColor() : FLinearColor::White;
+		Brush.TintRule = uint8(InBrush.TintColor == FSlateColor::UseSubduedForeground() ? ETintRule::SubduedForeground
+			: !InBrush.TintColor.IsColorSpecified() ? ETintRule::Foreground : ETintRule::Specified);
+		Brush.Margin = InBrush.Margin;
+		Brush.ImageSize = InBrush.ImageSize;
+		Brush.DrawAs = InBrush.DrawAs.GetValue();
+		Brush.Tiling = InBrush.Tiling.GetValue();
+		Brush.Mirroring = InBrush.Mirroring.GetValue();
+		Brush.ImageType = InBrush.ImageType.GetValue();
+		Brush.ResourcePathOffset = INDEX_NONE;
+
+		// Brushes that only have a resource name(style set brushes) can't be cooked, they'll come out without an image
+		if (UObject* Resource = InBrush.GetResourceObject())
+		{
+			const FTCHARToUTF8 ResourcePath(*FSoftObjectPath(Resource).ToString());
+			Brush.ResourcePathOffset = Strings.Num();
+			Strings.Append(ResourcePath.Get(), ResourcePath.Length() + 1);
+		}
+		return Brush;
+	}
+
+	static FSlateBrush MakeSlateBrush(const FBrush& InBrush, const ANSICHAR* Strings)
+	{
+		FSlateBrush Brush;
+		Brush.TintColor = InBrush.TintRule == uint8(ETintRule::SubduedForeground) ? FSlateColor::UseSubduedForeground()
+			: InBrush.TintRule == uint8(ETintRule::Foreground) ? FSlateColor::UseForeground() : FSlateColor(InBrush.Tint);
+		Brush.Margin = InBrush.Margin;
+		Brush.ImageSize = InBrush.ImageSize;
+		Brush.DrawAs = ESlateBrushDrawType::Type(InBrush.DrawAs);
+		Brush.Tiling = ESlateBrushTileType::Type(InBrush.Tiling);
+		Brush.Mirroring = ESlateBrushMirrorType::Type(InBrush.Mirroring);
+
+		if (InBrush.ResourcePathOffset != INDEX_NONE)
+		{
+			Brush.SetResourceObject(FSoftObjectPath(UTF8_TO_TCHAR(Strings + InBrush.ResourcePathOffset)).TryLoad());
+		}
+
+		// Setting the resource picks an image type for us, but put back whatever it had when it was cooked
+		Brush.ImageType = ESlateBrushImageType::Type(InBrush.ImageType);
+		return Brush;
+	}
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleCompactTreeCookCommand(
+	TEXT("ExampleUI.CompactTree.Cook"),
+	TEXT("Creates a user widget and cooks every border tree in it into a compact border tree file. Usage: ExampleUI.CompactTree.Cook <WidgetClassPath> [File=ExampleUI/CompactBorderTree.bin]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UClass* WidgetClass = Args.Num() > 0 ? LoadClass<UUserWidget>(nullptr, *Args[0]) : nullptr;
+		UUserWidget* Widget = WidgetClass && World ? CreateWidget<UUserWidget>(World, WidgetClass) : nullptr;
+		if (!Widget)
+		{
+			Ar.Logf(TEXT("ExampleUI.CompactTree.Cook: couldn't create a widget from '%s'"), Args.Num() > 0 ? *Args[0] : TEXT(""));
+			return;
+		}
+
+		// Native widgets only build their trees when their slate widget gets built
+		Widget->TakeWidget();
+
+		// Every border that isn't the content of another border is the root of a tree
+		TArray<UExampleBorder*> Roots;
+		Widget->WidgetTree->ForEachWidget([&Roots](UWidget* Child)
+		{
+			UExampleBorder* Border = Cast<UExampleBorder>(Child);
+			if (Border && !Cast<UExampleBorder>(Border->GetParent()))
+			{
+				Roots.Add(Border);
+			}
+		});
+
+		const FString Filename = Args.Num() > 1 ? Args[1] : TEXT("ExampleUI/CompactBorderTree.bin");
+		const FString FullPath = FPaths::IsRelative(Filename) ? FPaths::Combine(FPaths::ProjectSavedDir(), Filename) : Filename;
+		if (FExampleCompactBorderTree::CookToFile(Roots, FullPath))
+		{
+			Ar.Logf(TEXT("Cooked %d border trees from %s to %s"), Roots.Num(), *WidgetClass->GetName(), *FullPath);
+		}
+		else
+		{
+			Ar.Logf(TEXT("ExampleUI.CompactTree.Cook: failed to write %s"), *FullPath);
+		}
+	}));
+
+FExampleCompactBorderTree::FExampleCompactBorderTree()
+{
+}
+
+FExampleCompactBorderTree::~FExampleCompactBorderTree()
+{
+	// Unmap before closing the file
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+int32 FExampleCompactBorderTree::Cook(const TArray<UExampleBorder*>& Roots, TArray<uint8>& OutData)
+{
+	using namespace ExampleCompactBorderTree;
+
+	TArray<FNode> Nodes;
+	TArray<int32> RootIndices;
+	TArray<FSlateBrush> UniqueBrushes;
+	TArray<FBrush> Brushes;
+	TArray<ANSICHAR> Strings;
+
+	for (UExampleBorder* Root : Roots)
+	{
+		if (!Root)
+		{
+			continue;
+		}
+
+		RootIndices.Add(Nodes.Num());
+
+		// Borders only have the one child, so a tree of them is a chain we can just follow
+		for (UExampleBorder* Border = Root; Border; Border = Cast<UExampleBorder>(Border->GetContent()))
+		{
+			const FSlateBrush BorderBrush = Border->GetBrush();
+			int32 BrushIndex = UniqueBrushes.IndexOfByKey(BorderBrush);
+			if (BrushIndex == INDEX_NONE)
+			{
+				BrushIndex = UniqueBrushes.Add(BorderBrush);
+				Brushes.Add(MakeBrush(BorderBrush, Strings));
+			}
+
+			// The slot has the final say on padding and alignment once there's any content, like when the widget gets built
+			const UExampleBorderSlot* Slot = Cast<UExampleBorderSlot>(Border->GetContentSlot());
+
+			FNode& Node = Nodes.AddZeroed_GetRef();
+			Node.BrushColor = Border->BrushColor;
+			Node.ContentColorAndOpacity = Border->ContentColorAndOpacity;
+			Node.Padding = Slot ? Slot->GetPadding() : Border->Padding;
+			Node.DesiredSizeScale = Border->DesiredSizeScale;
+			Node.BrushIndex = BrushIndex;
+			Node.ContentIndex = Cast<UExampleBorder>(Border->GetContent()) ? Nodes.Num() : INDEX_NONE;
+			Node.HorizontalAlignment = Slot ? Slot->GetHorizontalAlignment() : Border->HorizontalAlignment.GetValue();
+			Node.VerticalAlignment = Slot ? Slot->GetVerticalAlignment() : Border->VerticalAlignment.GetValue();
+			Node.bShowEffectWhenDisabled = Border->bShowEffectWhenDisabled;
+		}
+	}
+
+	// Pad the strings out so the file stays a multiple of 4 bytes
+	Strings.AddZeroed(Align(Strings.Num(), 4) - Strings.Num());
+
+	FHeader Header;
+	Header.Magic = FileMagic;
+	Header.Version = FileVersion;
+	Header.NumNodes = Nodes.Num();
+	Header.NumRoots = RootIndices.Num();
+	Header.NumBrushes = Brushes.Num();
+	Header.NumStringBytes = Strings.Num();
+
+	OutData.Reset(GetStringsOffset(Header) + Strings.Num());
+	OutData.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+	OutData.Append(reinterpret_cast<const uint8*>(Nodes.GetData()), Nodes.Num() * sizeof(FNode));
+	OutData.Append(reinterpret_cast<const uint8*>(RootIndices.GetData()), RootIndices.Num() * sizeof(int32));
+	OutData.Append(reinterpret_cast<const uint8*>(Brushes.GetData()), Brushes.Num() * sizeof(FBrush));
+	OutData.Append(reinterpret_cast<const uint8*>(Strings.GetData()), Strings.Num());
+
+	return Nodes.Num();
+}
+
+bool FExampleCompactBorderTree::CookToFile(const TArray<UExampleBorder*>& Roots, const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	Cook(Roots, Bytes);
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+TSharedPtr<FExampleCompactBorderTree> FExampleCompactBorderTree::LoadFromFile(const FString& Filename)
+{
+	TSharedPtr<FExampleCompactBorderTree> Tree = MakeShareable(new FExampleCompactBorderTree());
+
+	// Mapping means only the pages we actually read get loaded, and nothing gets copied
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	Tree->MappedHandle.Reset(PlatformFile.OpenMapped(*Filename));
+	if (Tree->MappedHandle.IsValid() && Tree->MappedHandle->GetFileSize() > 0)
+	{
+		Tree->MappedRegion.Reset(Tree->MappedHandle->MapRegion(0, Tree->MappedHandle->GetFileSize()));
+	}
+
+	bool bValid = false;
+	if (Tree->MappedRegion.IsValid())
+	{
+		bValid = Tree->ReadData(Tree->MappedRegion->GetMappedPtr(), Tree->MappedRegion->GetMappedSize());
+	}
+	else if (FFileHelper::LoadFileToArray(Tree->LoadedData, *Filename))
+	{
+		bValid = Tree->ReadData(Tree->LoadedData.GetData(), Tree->LoadedData.Num());
+	}
+
+	if (!bValid)
+	{
+		return nullptr;
+	}
+
+	Tree->ResolveBrushes();
+	return Tree;
+}
+
+bool FExampleCompactBorderTree::ReadData(const uint8* InData, int64 InSize)
+{
+	using namespace ExampleCompactBorderTree;
+
+	if (!InData || InSize < int64(sizeof(FHeader)))
+	{
+		return false;
+	}
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(InData);
+	if (Header.Magic != FileMagic || Header.Version != FileVersion || Header.NumNodes < 0 || Header.NumRoots < 0 || Header.NumBrushes < 0 || Header.NumStringBytes < 0
+		|| GetStringsOffset(Header) + Header.NumStringBytes != InSize)
+	{
+		return false;
+	}
+
+	// A bad index would have Instantiate reading who knows what, so check everything once here instead of every time.
+	// Every node has at most one parent(a border or the root list), Instantiate would otherwise put the same widget in two places
+	TBitArray<> Claimed(false, Header.NumNodes);
+	const FNode* Nodes = reinterpret_cast<const FNode*>(InData + GetNodesOffset());
+	for (int32 Index = 0; Index < Header.NumNodes; ++Index)
+	{
+		// Content always comes after its border, which also means there can't be any loops
+		const FNode& Node = Nodes[Index];
+		if ((Node.ContentIndex != INDEX_NONE && (Node.ContentIndex <= Index || Node.ContentIndex >= Header.NumNodes || Claimed[Node.ContentIndex]))
+			|| (Node.BrushIndex != INDEX_NONE && (Node.BrushIndex < 0 || Node.BrushIndex >= Header.NumBrushes)))
+		{
+			return false;
+		}
+		if (Node.ContentIndex != INDEX_NONE)
+		{
+			Claimed[Node.ContentIndex] = true;
+		}
+	}
+
+	// A root can't also be some border's content, or listed twice
+	const int32* Roots = reinterpret_cast<const int32*>(InData + GetRootsOffset(Header));
+	for (int32 Index = 0; Index < Header.NumRoots; ++Index)
+	{
+		if (Roots[Index] < 0 || Roots[Index] >= Header.NumNodes || Claimed[Roots[Index]])
+		{
+			return false;
+		}
+		Claimed[Roots[Index]] = true;
+	}
+
+	// As long as the strings end with a terminator, any resource path that starts inside of them ends inside of them too
+	const FBrush* Brushes = reinterpret_cast<const FBrush*>(InData + GetBrushesOffset(Header));
+	const ANSICHAR* Strings = reinterpret_cast<const ANSICHAR*>(InData + GetStringsOffset(Header));
+	if (Header.NumStringBytes > 0 && Strings[Header.NumStringBytes - 1] != 0)
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < Header.NumBrushes; ++Index)
+	{
+		const int32 Offset = Brushes[Index].ResourcePathOffset;
+		if (Offset != INDEX_NONE && (Offset < 0 || Offset >= Header.NumStringBytes))
+		{
+			return false;
+		}
+	}
+
+	Data = InData;
+	DataSize = InSize;
+	NumNodes = Header.NumNodes;
+	NumRoots = Header.NumRoots;
+	return true;
+}
+
+void FExampleCompactBorderTree::ResolveBrushes()
+{
+	using namespace ExampleCompactBorderTree;
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	const FBrush* FileBrushes = reinterpret_cast<const FBrush*>(Data + GetBrushesOffset(Header));
+	const ANSICHAR* Strings = reinterpret_cast<const ANSICHAR*>(Data + GetStringsOffset(Header));
+
+	Brushes.Reset(Header.NumBrushes);
+	for (int32 Index = 0; Index < Header.NumBrushes; ++Index)
+	{
+		Brushes.Add(FExampleBrushPool::Get().Intern(MakeSlateBrush(FileBrushes[Index], Strings)));
+	}
+}
+
+TArray<TSharedRef<SExampleBorder>> FExampleCompactBorderTree::Instantiate() const
+{
+	using namespace ExampleCompactBorderTree;
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	const FNode* Nodes = reinterpret_cast<const FNode*>(Data + GetNodesOffset());
+	const int32* Roots = reinterpret_cast<const int32*>(Data + GetRootsOffset(Header));
+
+	// Content comes after its border, so building from the back means a border's content is always there by the time we get to it
+	TArray<TSharedPtr<SExampleBorder>> Borders;
+	Borders.SetNum(NumNodes);
+	for (int32 Index = NumNodes - 1; Index >= 0; --Index)
+	{
+		const FNode& Node = Nodes[Index];
+
+		TSharedRef<SWidget> Content = SNullWidget::NullWidget;
+		if (Node.ContentIndex != INDEX_NONE)
+		{
+			Content = Borders[Node.ContentIndex].ToSharedRef();
+		}
+
+		Borders[Index] = SNew(SExampleBorder)
+			.BorderImage(Node.BrushIndex != INDEX_NONE ? &Brushes[Node.BrushIndex].Get() : nullptr)
+			.BorderBackgroundColor(Node.BrushColor)
+			.ColorAndOpacity(Node.ContentColorAndOpacity)
+			.Padding(Node.Padding)
+			.HAlign(EHorizontalAlignment(Node.HorizontalAlignment))
+			.VAlign(EVerticalAlignment(Node.VerticalAlignment))
+			.DesiredSizeScale(Node.DesiredSizeScale)
+			.ShowEffectWhenDisabled(Node.bShowEffectWhenDisabled != 0)
+			[
+				Content
+			];
+	}
+
+	TArray<TSharedRef<SExampleBorder>> RootBorders;
+	RootBorders.Reserve(NumRoots);
+	for (int32 Index = 0; Index < NumRoots; ++Index)
+	{
+		RootBorders.Add(Borders[Roots[Index]].ToSharedRef());
+	}
+	return RootBorders;
+}
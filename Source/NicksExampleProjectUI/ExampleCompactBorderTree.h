@@ -0,0 +1,84 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+class SExampleBorder;
+class UExampleBorder;
+
+/**
+ * Border trees(brushes, colors, padding, alignment and which border goes inside which) cooked down into a flat binary file
+ * that gets memory mapped and turned straight into SExampleBorders, without a single UObject being created or deserialized.
+ *
+ * Loading a screen normally means a UExampleBorder and a UExampleBorderSlot for every border, each with all of its properties
+ * and reflection data, just so they can hand their values over to the slate widget. Everything in here is plain old data laid out
+ * exactly how it's read, so loading is mapping the file, checking it's sane and resolving the brushes(there's usually only a handful).
+ *
+ * Only what a border looks like gets cooked: anything that isn't a border gets left out along with bindings, events,
+ * view models and styles(their current brush and colors are cooked instead). Files are written in the byte order of whoever
+ * cooked them, cook them for the platform that'll load them.
+ *
+ * The instantiated widgets point at the brushes the tree holds onto, so keep the tree around as long as they are.
+ * Game thread only.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleCompactBorderTree
+{
+public:
+
+	~FExampleCompactBorderTree();
+
+	/**
+	 * Cooks the borders under each of the given roots, following each border's content for as long as it's another border.
+	 * Returns the number of borders that were cooked.
+	 */
+	static int32 Cook(const TArray<UExampleBorder*>& Roots, TArray<uint8>& OutData);
+
+	/** Cooks the borders and saves them to a file, returns false if the file couldn't be written */
+	static bool CookToFile(const TArray<UExampleBorder*>& Roots, const FString& Filename);
+
+	/** Maps the file(or reads it in if the platform can't map files) and resolves its brushes, returns null if it's missing or isn't a valid tree */
+	static TSharedPtr<FExampleCompactBorderTree> LoadFromFile(const FString& Filename);
+
+	/** Builds the slate widgets, returns the outermost border of each of the roots that were cooked */
+	TArray<TSharedRef<SExampleBorder>> Instantiate() const;
+
+	int32 GetNumBorders() const { return NumNodes; }
+	int32 GetNumRoots() const { return NumRoots; }
+	int32 GetNumBrushes() const { return Brushes.Num(); }
+
+	/** How big the file is, this is all the memory the tree takes up besides its brushes */
+	int64 GetDataSize() const { return DataSize; }
+
+	/** Whether the file's mapped, otherwise we had to read it into memory */
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+
+private:
+
+	FExampleCompactBorderTree();
+
+	/** Checks the data is a tree we can read and points us at its parts, returns false if it isn't */
+	bool ReadData(const uint8* InData, int64 InSize);
+
+	/** Loads the brushes' resources and pools the brushes */
+	void ResolveBrushes();
+
+	// The mapped file, the region has to go before the handle does
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** The file's contents when it couldn't be mapped */
+	TArray<uint8> LoadedData;
+
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+
+	int32 NumNodes = 0;
+	int32 NumRoots = 0;
+
+	/** The brushes the nodes point at, pooled so they're shared with any other border using the same brush */
+	TArray<TSharedRef<const FSlateBrush>> Brushes;
+};
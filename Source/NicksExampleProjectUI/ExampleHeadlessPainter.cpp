@@ -0,0 +1,83 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleHeadlessPainter.h"
+#include "Application/SlateApplicationBase.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "Widgets/SWidget.h"
+#include "Widgets/SWindow.h"
+
+FExampleHeadlessPainter::FExampleHeadlessPainter(const FVector2D& InSize, float InScale)
+	: Size(InSize)
+	, Scale(InScale)
+	// We don't have a window to paint into, the element list is fine without one for our purposes
+	, ElementList(MakeUnique<FSlateWindowElementList>(TSharedPtr<SWindow>()))
+{
+	EnsureSlateStyle();
+}
+
+FExampleHeadlessPainter::~FExampleHeadlessPainter()
+{
+}
+
+FGeometry FExampleHeadlessPainter::GetRootGeometry() const
+{
+	return FGeometry::MakeRoot(Size, FSlateLayoutTransform(Scale));
+}
+
+void FExampleHeadlessPainter::Paint(const TSharedRef<SWidget>& InWidget, float InDeltaTime)
+{
+	CurrentTime += InDeltaTime;
+
+	// Layout first, this is what computes every widget's desired size
+	const double PrepassStart = FPlatformTime::Seconds();
+	InWidget->SlatePrepass(Scale);
+	LastPrepassMs = (FPlatformTime::Seconds() - PrepassStart) * 1000.0;
+
+	ElementList->ResetElementList();
+	HittestGrid.SetHittestArea(FVector2D::ZeroVector, Size * Scale);
+	HittestGrid.Clear();
+
+	const FGeometry RootGeometry = GetRootGeometry();
+	const FSlateRect CullingRect(FVector2D::ZeroVector, Size * Scale);
+	const FPaintArgs PaintArgs(nullptr, HittestGrid, FVector2D::ZeroVector, CurrentTime, InDeltaTime);
+
+	const double PaintStart = FPlatformTime::Seconds();
+	InWidget->Paint(PaintArgs, RootGeometry, CullingRect, *ElementList, 0, FWidgetStyle(), true);
+	LastPaintMs = (FPlatformTime::Seconds() - PaintStart) * 1000.0;
+}
+
+void FExampleHeadlessPainter::PaintWindow(const TSharedRef<SWindow>& InWindow, float InDeltaTime)
+{
+	check(FSlateApplicationBase::IsInitialized());
+	CurrentTime += InDeltaTime;
+
+	// The window's invalidation root caches elements against the window they were painted for, so the list has to be that window's
+	if (ElementList->GetPaintWindow() != &InWindow.Get())
+	{
+		ElementList = MakeUnique<FSlateWindowElementList>(InWindow);
+	}
+
+	// Same as FSlateApplication's prepass: let the invalidation root process what got invalidated, then prepass at the scale
+	// PaintWindow is going to lay the window out with
+	const double PrepassStart = FPlatformTime::Seconds();
+	InWindow->ProcessWindowInvalidation();
+	InWindow->SlatePrepass(FSlateApplicationBase::Get().GetApplicationScale() * InWindow->GetDPIScaleFactor());
+	LastPrepassMs = (FPlatformTime::Seconds() - PrepassStart) * 1000.0;
+
+	ElementList->ResetElementList();
+
+	const double PaintStart = FPlatformTime::Seconds();
+	InWindow->PaintWindow(CurrentTime, InDeltaTime, *ElementList, FWidgetStyle(), true);
+	LastPaintMs = (FPlatformTime::Seconds() - PaintStart) * 1000.0;
+}
+
+void FExampleHeadlessPainter::EnsureSlateStyle()
+{
+	// Commandlets don't set up Slate, but our widgets default to brushes from the core style
+	if (!FCoreStyle::IsStyleInitialized())
+	{
+		FCoreStyle::ResetToDefault();
+	}
+}
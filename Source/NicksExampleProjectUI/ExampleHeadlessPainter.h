@@ -0,0 +1,71 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Input/HittestGrid.h"
+
+class SWidget;
+class SWindow;
+class FSlateWindowElementList;
+
+/**
+ * Lays out and paints a widget tree into a draw element list without a window, viewport or GPU.
+ * This is what our headless tools(stress commandlet, overdraw/batch analysis...etc) use to get at the elements a tree produces.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleHeadlessPainter
+{
+public:
+
+	/**
+	 * @param InSize	The size(in slate units) of the area the widget gets painted into
+	 * @param InScale	The DPI scale to paint at
+	 */
+	FExampleHeadlessPainter(const FVector2D& InSize, float InScale = 1.0f);
+	~FExampleHeadlessPainter();
+
+	/** Runs the layout prepass and paints the widget, replacing whatever was painted before */
+	void Paint(const TSharedRef<SWidget>& InWidget, float InDeltaTime = 1.0f / 60.0f);
+
+	/**
+	 * Prepasses and paints a window the way FSlateApplication does every frame, so with global invalidation on it goes
+	 * through the window's invalidation root(and its fast path) rather than painting the whole tree. The window doesn't need
+	 * a native window or to be added to the application, but slate does need to be initialized. Ignores our size and scale,
+	 * the window's own are what it lays out and paints with.
+	 */
+	void PaintWindow(const TSharedRef<SWindow>& InWindow, float InDeltaTime = 1.0f / 60.0f);
+
+	/** The element list from the last call to Paint */
+	FSlateWindowElementList& GetElementList() const { return *ElementList; }
+
+	/** The hit test grid the last paint filled in, for finding what's under a point like slate does when the mouse moves */
+	const FHittestGrid& GetHittestGrid() const { return HittestGrid; }
+
+	/** The geometry the widget gets painted with */
+	FGeometry GetRootGeometry() const;
+
+	/** The size in pixels of what gets painted, our size times the DPI scale */
+	FIntPoint GetResolution() const { return (Size * Scale).IntPoint(); }
+
+	/** How long the prepass and paint took on the last call to Paint */
+	double GetLastPrepassMs() const { return LastPrepassMs; }
+	double GetLastPaintMs() const { return LastPaintMs; }
+
+	void SetScale(float InScale) { Scale = InScale; }
+	float GetScale() const { return Scale; }
+
+	/** Slate's core style needs to exist before our widgets can be built, this makes sure it does */
+	static void EnsureSlateStyle();
+
+private:
+
+	FVector2D Size;
+	float Scale;
+	double CurrentTime = 0.0;
+
+	double LastPrepassMs = 0.0;
+	double LastPaintMs = 0.0;
+
+	TUniquePtr<FSlateWindowElementList> ElementList;
+	FHittestGrid HittestGrid;
+};
@@ -0,0 +1,358 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleNameplateSubsystem.h"
+#include "ExampleBorderStyleRegistry.h"
+#include "ExampleUIStats.h"
+#include "NicksExampleProjectCharacter.h"
+#include "SExampleNameplateLayer.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "Rendering/SlateRenderer.h"
+#include "SceneView.h"
+#include "Styling/CoreStyle.h"
+
+DECLARE_CYCLE_STAT(TEXT("Nameplate Update"), STAT_ExampleNameplateUpdate, STATGROUP_ExampleUI);
+
+static int32 GExampleNameplatesEnable = 1;
+static FAutoConsoleVariableRef CVarExampleNameplatesEnable(
+	TEXT("ExampleUI.Nameplates.Enable"),
+	GExampleNameplatesEnable,
+	TEXT("Draws nameplates over characters."));
+
+static float GExampleNameplateMaxDistance = 5000.0f;
+static FAutoConsoleVariableRef CVarExampleNameplateMaxDistance(
+	TEXT("ExampleUI.Nameplates.MaxDistance"),
+	GExampleNameplateMaxDistance,
+	TEXT("Nameplates further away from the camera than this aren't drawn."));
+
+static float GExampleNameplateFullSizeDistance = 1000.0f;
+static FAutoConsoleVariableRef CVarExampleNameplateFullSizeDistance(
+	TEXT("ExampleUI.Nameplates.FullSizeDistance"),
+	GExampleNameplateFullSizeDistance,
+	TEXT("Nameplates closer to the camera than this are drawn at full size, further away they shrink."));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleNameplateStatsCommand(
+	TEXT("ExampleUI.Nameplates.Stats"),
+	TEXT("Prints how many nameplates there are, how many got drawn last frame and how long updating them took."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (UExampleNameplateSubsystem* Nameplates = World ? World->GetSubsystem<UExampleNameplateSubsystem>() : nullptr)
+		{
+			Nameplates->DumpStats(Ar);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleNameplateSpawnCommand(
+	TEXT("ExampleUI.Nameplates.Spawn"),
+	TEXT("Spawns a grid of characters in front of the player to stress the nameplates. Usage: ExampleUI.Nameplates.Spawn [Count=500] [Spacing=150]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+		APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!Pawn)
+		{
+			Ar.Logf(TEXT("ExampleUI.Nameplates.Spawn needs a player pawn to spawn in front of"));
+			return;
+		}
+
+		const int32 Count = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 500, 1);
+		const float Spacing = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 150.0f;
+		const int32 Columns = FMath::CeilToInt(FMath::Sqrt(float(Count)));
+
+		const FVector Forward = Pawn->GetActorForwardVector().GetSafeNormal2D();
+		const FVector Right = FVector::CrossProduct(FVector::UpVector, Forward);
+		const FVector Origin = Pawn->GetActorLocation() + Forward * Spacing * 2.0f - Right * Spacing * (Columns - 1) * 0.5f;
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		int32 NumSpawned = 0;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FVector Location = Origin + Forward * Spacing * (Index / Columns) + Right * Spacing * (Index % Columns);
+			if (World->SpawnActor<ANicksExampleProjectCharacter>(Location, Pawn->GetActorRotation(), SpawnParameters))
+			{
+				++NumSpawned;
+			}
+		}
+		Ar.Logf(TEXT("Spawned %d characters"), NumSpawned);
+	}));
+
+bool UExampleNameplateSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Nobody's looking at a dedicated server
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UExampleNameplateSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Font = FCoreStyle::GetDefaultFontStyle("Regular", 10);
+
+	if (UWorld* World = GetWorld())
+	{
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UExampleNameplateSubsystem::HandleActorSpawned));
+	}
+	bInitialized = true;
+}
+
+void UExampleNameplateSubsystem::Deinitialize()
+{
+	bInitialized = false;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+
+	if (Layer.IsValid() && LayerViewport.IsValid())
+	{
+		LayerViewport->RemoveViewportWidgetContent(Layer.ToSharedRef());
+	}
+	Layer.Reset();
+	LayerViewport.Reset();
+
+	Nameplates.Empty();
+	DrawData.Empty();
+
+	Super::Deinitialize();
+}
+
+ETickableTickType UExampleNameplateSubsystem::GetTickableTickType() const
+{
+	// Our class default object gets constructed too, that one should never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UExampleNameplateSubsystem::IsTickable() const
+{
+	return bInitialized;
+}
+
+TStatId UExampleNameplateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UExampleNameplateSubsystem, STATGROUP_Tickables);
+}
+
+void UExampleNameplateSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	if (!bFoundExistingCharacters)
+	{
+		for (TActorIterator<ANicksExampleProjectCharacter> It(World); It; ++It)
+		{
+			AddCharacter(*It);
+		}
+		bFoundExistingCharacters = true;
+	}
+
+	AddLayerToViewport();
+	RefreshStyle();
+	UpdateDrawData();
+}
+
+void UExampleNameplateSubsystem::SetNameplate(AActor* Actor, FText Text, FLinearColor Tint)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	FNameplate* Nameplate = Nameplates.FindByPredicate([Actor](const FNameplate& Existing) { return Existing.Actor.Get() == Actor; });
+	if (!Nameplate)
+	{
+		Nameplate = &Nameplates.AddDefaulted_GetRef();
+		Nameplate->Actor = Actor;
+		Nameplate->HeightOffset = Actor->GetSimpleCollisionHalfHeight() + 20.0f;
+	}
+	// The measuring is the expensive part, so only do it when the text actually changed
+	else if (Nameplate->Text.EqualTo(Text))
+	{
+		Nameplate->Tint = Tint;
+		return;
+	}
+
+	Nameplate->Text = Text;
+	Nameplate->TextSize = MeasureText(Text);
+	Nameplate->Tint = Tint;
+}
+
+void UExampleNameplateSubsystem::RemoveNameplate(AActor* Actor)
+{
+	Nameplates.RemoveAllSwap([Actor](const FNameplate& Existing) { return Existing.Actor.Get() == Actor; });
+}
+
+const FSlateBrush* UExampleNameplateSubsystem::GetBrush() const
+{
+	return StyleBrush.IsValid() ? StyleBrush.Get() : FCoreStyle::Get().GetBrush("Border");
+}
+
+void UExampleNameplateSubsystem::DumpStats(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Nameplates: %d total, %d drawn last frame, %.3f ms to update"), Nameplates.Num(), DrawData.Num(), LastUpdateMs);
+}
+
+void UExampleNameplateSubsystem::HandleActorSpawned(AActor* Actor)
+{
+	// Don't bother until we've gone looking for the ones that already exist, that'll pick this one up too
+	if (bFoundExistingCharacters && Actor && Actor->IsA<ANicksExampleProjectCharacter>())
+	{
+		AddCharacter(Actor);
+	}
+}
+
+void UExampleNameplateSubsystem::AddCharacter(AActor* Actor)
+{
+	if (Nameplates.ContainsByPredicate([Actor](const FNameplate& Existing) { return Existing.Actor.Get() == Actor; }))
+	{
+		return;
+	}
+
+	// Players get their player name, everyone else just gets their object name
+	const APawn* Pawn = Cast<APawn>(Actor);
+	const APlayerState* PlayerState = Pawn ? Pawn->GetPlayerState() : nullptr;
+	SetNameplate(Actor, FText::FromString(PlayerState ? PlayerState->GetPlayerName() : Actor->GetName()));
+}
+
+void UExampleNameplateSubsystem::AddLayerToViewport()
+{
+	UGameViewportClient* GameViewport = GetWorld()->GetGameViewport();
+	if (!GameViewport || LayerViewport.Get() == GameViewport)
+	{
+		return;
+	}
+
+	if (!Layer.IsValid())
+	{
+		Layer = SNew(SExampleNameplateLayer, this);
+	}
+
+	// Below everything else on the viewport(which is where UMG widgets go by default), nameplates are part of the world really
+	GameViewport->AddViewportWidgetContent(Layer.ToSharedRef(), -10);
+	LayerViewport = GameViewport;
+}
+
+void UExampleNameplateSubsystem::RefreshStyle()
+{
+	UExampleBorderStyleRegistry* StyleRegistry = UExampleBorderStyleRegistry::Get();
+	if (!StyleRegistry || StyleRegistry->GetGeneration() == StyleGeneration)
+	{
+		return;
+	}
+	StyleGeneration = StyleRegistry->GetGeneration();
+
+	static const FName NameplateStyleId("Nameplate");
+	if (const FExampleBorderStyle* Style = StyleRegistry->FindStyle(NameplateStyleId, &StyleBrush))
+	{
+		BrushColor = Style->BrushColor;
+		TextColor = Style->ContentColorAndOpacity;
+	}
+}
+
+void UExampleNameplateSubsystem::UpdateDrawData()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ExampleNameplateUpdate);
+	const double StartTime = FPlatformTime::Seconds();
+
+	DrawData.Reset();
+
+	// We draw from the first local player's point of view
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	if (!GExampleNameplatesEnable || !LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport)
+	{
+		return;
+	}
+
+	// Work the view projection out once for every nameplate, PlayerController::ProjectWorldLocationToScreen would do it per call
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, eSSP_FULL, ProjectionData))
+	{
+		return;
+	}
+	const FMatrix ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+
+	// Let nameplates a little way off the edge through, they'd pop in and out otherwise
+	const float ScreenMargin = 100.0f;
+	const float MaxDistanceSquared = FMath::Square(GExampleNameplateMaxDistance);
+	const APawn* ViewPawn = PlayerController->GetPawn();
+
+	for (int32 Index = Nameplates.Num() - 1; Index >= 0; --Index)
+	{
+		const FNameplate& Nameplate = Nameplates[Index];
+		const AActor* Actor = Nameplate.Actor.Get();
+		if (!Actor)
+		{
+			Nameplates.RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		// We don't need to see our own name
+		if (Actor == ViewPawn || Actor->IsHidden())
+		{
+			continue;
+		}
+
+		const FVector Location = Actor->GetActorLocation() + FVector(0.0f, 0.0f, Nameplate.HeightOffset);
+		const float DistanceSquared = FVector::DistSquared(Location, ProjectionData.ViewOrigin);
+		if (DistanceSquared > MaxDistanceSquared)
+		{
+			continue;
+		}
+
+		// This fails for anything behind the camera
+		FVector2D ScreenPosition;
+		if (!FSceneView::ProjectWorldToScreen(Location, ViewRect, ViewProjectionMatrix, ScreenPosition))
+		{
+			continue;
+		}
+
+		if (ScreenPosition.X < ViewRect.Min.X - ScreenMargin || ScreenPosition.X > ViewRect.Max.X + ScreenMargin
+			|| ScreenPosition.Y < ViewRect.Min.Y - ScreenMargin || ScreenPosition.Y > ViewRect.Max.Y + ScreenMargin)
+		{
+			continue;
+		}
+
+		const float Distance = FMath::Sqrt(DistanceSquared);
+
+		FExampleNameplateDrawData& Data = DrawData.AddDefaulted_GetRef();
+		Data.ScreenPosition = ScreenPosition;
+		Data.Scale = FMath::Clamp(GExampleNameplateFullSizeDistance / FMath::Max(Distance, 1.0f), 0.4f, 1.0f);
+		Data.Text = Nameplate.Text;
+		Data.TextSize = Nameplate.TextSize;
+		Data.Tint = Nameplate.Tint;
+		Data.Distance = Distance;
+	}
+
+	// Furthest first, so closer nameplates end up on top of the ones behind them
+	DrawData.Sort([](const FExampleNameplateDrawData& A, const FExampleNameplateDrawData& B) { return A.Distance > B.Distance; });
+
+	INC_DWORD_STAT_BY(STAT_ExampleNameplatesDrawn, DrawData.Num());
+	LastUpdateMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+FVector2D UExampleNameplateSubsystem::MeasureText(const FText& Text) const
+{
+	if (!FSlateApplication::IsInitialized())
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	return FontMeasure->Measure(Text, Font);
+}
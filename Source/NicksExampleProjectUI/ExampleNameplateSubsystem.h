@@ -0,0 +1,144 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "ExampleNameplateSubsystem.generated.h"
+
+class SExampleNameplateLayer;
+class UGameViewportClient;
+
+/** Everything the nameplate layer needs to draw one nameplate this frame, already projected to the screen */
+struct FExampleNameplateDrawData
+{
+	/** Where the bottom center of the nameplate goes, in viewport pixels */
+	FVector2D ScreenPosition;
+
+	/** How much to shrink the nameplate by, nameplates further away get smaller */
+	float Scale;
+
+	FText Text;
+
+	/** The size of the text at a scale of 1, measured once when the text was set */
+	FVector2D TextSize;
+
+	FLinearColor Tint;
+
+	/** How far away from the camera it is, for sorting */
+	float Distance;
+};
+
+/**
+ * Draws nameplates over every character in the world using a single slate widget on the viewport, instead of each character
+ * having a widget component with its own widget tree(and render target) which falls over once there's a crowd.
+ *
+ * Every frame the nameplates get projected to the screen in one go(with the view projection worked out once, not per character),
+ * anything too far away or off screen gets skipped and the rest are handed to SExampleNameplateLayer which draws all of their
+ * borders on one layer and all of their text on the next, so every nameplate ends up in the same couple of draw batches.
+ *
+ * Characters get picked up automatically, anything else can be given a nameplate with SetNameplate.
+ * Nameplates take their look from the "Nameplate" border style in the UExampleBorderStyleRegistry if there is one.
+ */
+UCLASS()
+class NICKSEXAMPLEPROJECTUI_API UExampleNameplateSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	//~ Begin USubsystem Interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	//~ End FTickableGameObject Interface
+
+	/** Gives an actor a nameplate, or changes the one it has */
+	UFUNCTION(BlueprintCallable, Category = "Nameplates")
+	void SetNameplate(AActor* Actor, FText Text, FLinearColor Tint = FLinearColor::White);
+
+	/** Takes an actor's nameplate away */
+	UFUNCTION(BlueprintCallable, Category = "Nameplates")
+	void RemoveNameplate(AActor* Actor);
+
+	/** The nameplates to draw this frame, furthest away first */
+	const TArray<FExampleNameplateDrawData>& GetDrawData() const { return DrawData; }
+
+	/** The brush and colors every nameplate is drawn with */
+	const FSlateBrush* GetBrush() const;
+	FLinearColor GetBrushColor() const { return BrushColor; }
+	FLinearColor GetTextColor() const { return TextColor; }
+	const FSlateFontInfo& GetFont() const { return Font; }
+
+	/** Padding between the edge of a nameplate and its text, at a scale of 1 */
+	FVector2D GetPadding() const { return FVector2D(6.0f, 2.0f); }
+
+	/** How long projecting the nameplates took last frame */
+	double GetLastUpdateMs() const { return LastUpdateMs; }
+
+	/** Prints how many nameplates there are, how many got drawn and how long it took */
+	void DumpStats(FOutputDevice& Ar) const;
+
+private:
+
+	struct FNameplate
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FText Text;
+		FVector2D TextSize;
+		FLinearColor Tint;
+
+		/** How far above the actor's location the nameplate sits */
+		float HeightOffset;
+	};
+
+	/** Picks up characters as they get spawned */
+	void HandleActorSpawned(AActor* Actor);
+
+	/** Gives a character a nameplate if it hasn't got one already */
+	void AddCharacter(AActor* Actor);
+
+	/** Puts our layer on the game viewport once there is one */
+	void AddLayerToViewport();
+
+	/** Picks up our look from the style registry whenever its styles change */
+	void RefreshStyle();
+
+	/** Projects every nameplate to the screen and builds this frame's draw data */
+	void UpdateDrawData();
+
+	/** Measuring text isn't cheap so it only happens when a nameplate's text changes */
+	FVector2D MeasureText(const FText& Text) const;
+
+	TArray<FNameplate> Nameplates;
+	TArray<FExampleNameplateDrawData> DrawData;
+
+	TSharedPtr<SExampleNameplateLayer> Layer;
+	TWeakObjectPtr<UGameViewportClient> LayerViewport;
+
+	FDelegateHandle ActorSpawnedHandle;
+
+	bool bInitialized = false;
+
+	/** Characters that were already in the level don't get spawned, so we go looking for them on our first tick */
+	bool bFoundExistingCharacters = false;
+
+	TSharedPtr<const FSlateBrush> StyleBrush;
+	FLinearColor BrushColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.6f);
+	FLinearColor TextColor = FLinearColor::White;
+	uint32 StyleGeneration = MAX_uint32;
+
+	FSlateFontInfo Font;
+
+	double LastUpdateMs = 0.0;
+};
@@ -0,0 +1,132 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleOverdrawAnalyzer.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Rendering/DrawElements.h"
+
+FExampleOverdrawAnalyzer::FExampleOverdrawAnalyzer(const FIntPoint& InResolution)
+	: Resolution(FMath::Max(InResolution.X, 1), FMath::Max(InResolution.Y, 1))
+{
+}
+
+void FExampleOverdrawAnalyzer::Analyze(const FSlateWindowElementList& InElementList)
+{
+	Stats = FExampleOverdrawStats();
+	Counts.Reset();
+	Counts.SetNumZeroed(Resolution.X * Resolution.Y);
+
+	for (const FSlateDrawElement& Element : InElementList.GetUncachedDrawElements())
+	{
+		// Borders(and anything else drawing a brush as a box) are what we care about
+		if (Element.GetElementType() != EElementType::ET_Box && Element.GetElementType() != EElementType::ET_Border)
+		{
+			continue;
+		}
+
+		// Work out the bounding rectangle of the box in window space
+		const FSlateRenderTransform& Transform = Element.GetRenderTransform();
+		const FVector2D LocalSize = Element.GetLocalSize();
+		const FVector2D Corners[4] =
+		{
+			TransformPoint(Transform, FVector2D(0.0f, 0.0f)),
+			TransformPoint(Transform, FVector2D(LocalSize.X, 0.0f)),
+			TransformPoint(Transform, FVector2D(0.0f, LocalSize.Y)),
+			TransformPoint(Transform, LocalSize)
+		};
+
+		FVector2D Min = Corners[0];
+		FVector2D Max = Corners[0];
+		for (const FVector2D& Corner : Corners)
+		{
+			Min = FVector2D::Min(Min, Corner);
+			Max = FVector2D::Max(Max, Corner);
+		}
+
+		// A pixel counts if its center is inside the box, and anything off screen gets cut off
+		const int32 MinX = FMath::Clamp(FMath::RoundToInt(Min.X), 0, Resolution.X);
+		const int32 MinY = FMath::Clamp(FMath::RoundToInt(Min.Y), 0, Resolution.Y);
+		const int32 MaxX = FMath::Clamp(FMath::RoundToInt(Max.X), 0, Resolution.X);
+		const int32 MaxY = FMath::Clamp(FMath::RoundToInt(Max.Y), 0, Resolution.Y);
+
+		++Stats.NumBoxes;
+		for (int32 Y = MinY; Y < MaxY; ++Y)
+		{
+			uint16* Row = Counts.GetData() + Y * Resolution.X;
+			for (int32 X = MinX; X < MaxX; ++X)
+			{
+				// Saturate rather than wrap around if something is really going wrong
+				Row[X] = Row[X] < MAX_uint16 ? Row[X] + 1 : Row[X];
+			}
+		}
+	}
+
+	for (const uint16 Count : Counts)
+	{
+		if (Count > 0)
+		{
+			++Stats.CoveredPixels;
+			Stats.ShadedPixels += Count;
+			Stats.MaxOverdraw = FMath::Max<int32>(Stats.MaxOverdraw, Count);
+			++Stats.Histogram[FMath::Min<int32>(Count, FExampleOverdrawStats::NumHistogramBuckets) - 1];
+		}
+	}
+}
+
+int32 FExampleOverdrawAnalyzer::GetOverdrawAt(int32 X, int32 Y) const
+{
+	if (X < 0 || Y < 0 || X >= Resolution.X || Y >= Resolution.Y || Counts.Num() == 0)
+	{
+		return 0;
+	}
+	return Counts[Y * Resolution.X + X];
+}
+
+FColor FExampleOverdrawAnalyzer::GetHeatmapColor(int32 InOverdraw)
+{
+	// The usual overdraw view colors, it only gets worse from red
+	static const FColor Colors[] =
+	{
+		FColor::Black,
+		FColor(0, 64, 255),
+		FColor(0, 200, 0),
+		FColor(255, 255, 0),
+		FColor(255, 128, 0),
+		FColor(255, 0, 0)
+	};
+	return Colors[FMath::Clamp(InOverdraw, 0, int32(UE_ARRAY_COUNT(Colors)) - 1)];
+}
+
+bool FExampleOverdrawAnalyzer::ExportHeatmap(const FString& InFilePattern, FString* OutFilename) const
+{
+	if (Counts.Num() == 0)
+	{
+		return false;
+	}
+
+	TArray<FColor> Pixels;
+	Pixels.SetNumUninitialized(Counts.Num());
+	for (int32 Index = 0; Index < Counts.Num(); ++Index)
+	{
+		Pixels[Index] = GetHeatmapColor(Counts[Index]);
+	}
+
+	const FString FullPattern = FPaths::IsRelative(InFilePattern) ? FPaths::Combine(FPaths::ProjectSavedDir(), InFilePattern) : InFilePattern;
+	return FFileHelper::CreateBitmap(*FullPattern, Resolution.X, Resolution.Y, Pixels.GetData(), nullptr, &IFileManager::Get(), OutFilename);
+}
+
+void FExampleOverdrawAnalyzer::LogStats(FOutputDevice& Ar) const
+{
+	const int64 TotalPixels = int64(Resolution.X) * Resolution.Y;
+
+	Ar.Logf(TEXT("Overdraw at %dx%d: %d boxes"), Resolution.X, Resolution.Y, Stats.NumBoxes);
+	Ar.Logf(TEXT("  %lld pixels covered(%.1f%% of the screen), %lld pixels shaded, %.2f average overdraw, %d max"),
+		Stats.CoveredPixels, TotalPixels > 0 ? 100.0 * Stats.CoveredPixels / TotalPixels : 0.0, Stats.ShadedPixels, Stats.GetAverageOverdraw(), Stats.MaxOverdraw);
+
+	for (int32 Bucket = 0; Bucket < FExampleOverdrawStats::NumHistogramBuckets; ++Bucket)
+	{
+		const bool bLastBucket = Bucket == FExampleOverdrawStats::NumHistogramBuckets - 1;
+		Ar.Logf(TEXT("  %d%s: %lld pixels"), Bucket + 1, bLastBucket ? TEXT("+") : TEXT(" "), Stats.Histogram[Bucket]);
+	}
+}
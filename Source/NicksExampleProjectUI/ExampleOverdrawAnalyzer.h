@@ -0,0 +1,78 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSlateWindowElementList;
+
+/** What an FExampleOverdrawAnalyzer found */
+struct FExampleOverdrawStats
+{
+	/** How many box elements were rasterized */
+	int32 NumBoxes = 0;
+
+	/** Pixels with at least one box on them */
+	int64 CoveredPixels = 0;
+
+	/** Every time a box touched a pixel, so with no overdraw at all this would equal CoveredPixels */
+	int64 ShadedPixels = 0;
+
+	/** The most boxes drawn on top of each other in any one pixel */
+	int32 MaxOverdraw = 0;
+
+	/** How many pixels were drawn 1, 2, 3...etc times, the last bucket holds everything at or above it */
+	static constexpr int32 NumHistogramBuckets = 8;
+	int64 Histogram[NumHistogramBuckets] = {};
+
+	/** The average number of times a covered pixel gets drawn */
+	double GetAverageOverdraw() const { return CoveredPixels > 0 ? double(ShadedPixels) / CoveredPixels : 0.0; }
+};
+
+/**
+ * Works out overdraw on the CPU from the draw elements a widget tree painted(see FExampleHeadlessPainter), no GPU needed.
+ * Every box element(what SExampleBorder::OnPaint makes through MakeBox) gets its bounding rectangle rasterized
+ * into a per pixel count, which can then be exported as a heatmap image.
+ *
+ * This is an estimate: rotated boxes count their whole bounding rectangle, clipping and transparent brush pixels are ignored,
+ * and only the uncached elements are looked at(cached invalidation panel elements aren't in there).
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleOverdrawAnalyzer
+{
+public:
+
+	/** @param InResolution	The size in pixels of what was painted(the painted size times the DPI scale) */
+	explicit FExampleOverdrawAnalyzer(const FIntPoint& InResolution);
+
+	/** Clears out the previous results and rasterizes the boxes in the given element list */
+	void Analyze(const FSlateWindowElementList& InElementList);
+
+	const FExampleOverdrawStats& GetStats() const { return Stats; }
+
+	/** How many boxes cover a pixel */
+	int32 GetOverdrawAt(int32 X, int32 Y) const;
+
+	/**
+	 * Writes the overdraw counts as a heatmap bitmap(black is nothing, blue once, then green, yellow, orange and red for 5+ times)
+	 *
+	 * @param InFilePattern		Base file name, relative paths go in the project's saved directory. A number and .bmp get added to it
+	 * @param OutFilename		The file that actually got written
+	 * @return Whether or not the file was written
+	 */
+	bool ExportHeatmap(const FString& InFilePattern, FString* OutFilename = nullptr) const;
+
+	/** Prints the summary stats */
+	void LogStats(FOutputDevice& Ar) const;
+
+	/** The heatmap color for a pixel drawn InOverdraw times */
+	static FColor GetHeatmapColor(int32 InOverdraw);
+
+private:
+
+	FIntPoint Resolution;
+
+	/** One count per pixel, row by row */
+	TArray<uint16> Counts;
+
+	FExampleOverdrawStats Stats;
+};
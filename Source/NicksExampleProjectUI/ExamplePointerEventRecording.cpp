@@ -0,0 +1,407 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExamplePointerEventRecording.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace ExamplePointerEventRecording
+{
+	/** "EXPR" */
+	static const uint32 FileMagic = 0x52505845;
+	static const uint16 FileVersion = 1;
+
+	/** How many bytes each event takes up in a file, see operator<< for FExampleRecordedPointerEvent */
+	static const int64 SerializedEventSize = 19;
+
+	/** The mouse buttons we can record, a recorded button is an index into this */
+	static const FKey& GetButtonKey(int32 Index)
+	{
+		static const FKey Buttons[] = { EKeys::LeftMouseButton, EKeys::RightMouseButton, EKeys::MiddleMouseButton, EKeys::ThumbMouseButton, EKeys::ThumbMouseButton2 };
+		return Buttons[Index];
+	}
+	static const int32 NumButtons = 5;
+
+	static uint8 GetButtonIndex(const FKey& Key)
+	{
+		for (int32 Index = 0; Index < NumButtons; ++Index)
+		{
+			if (GetButtonKey(Index) == Key)
+			{
+				return static_cast<uint8>(Index);
+			}
+		}
+		return 0xFF;
+	}
+
+	// The recorder/replayer driven by the console commands
+	static TSharedPtr<FExamplePointerEventRecorder> ConsoleRecorder;
+	static FString ConsoleRecordingFilename;
+	static TUniquePtr<FExamplePointerEventReplayer> ConsoleReplayer;
+}
+
+/*************************RECORDED EVENT***************************/
+
+FExampleRecordedPointerEvent FExampleRecordedPointerEvent::FromPointerEvent(EExamplePointerEventType InType, const FPointerEvent& InEvent, uint32 InTimeMicroseconds)
+{
+	using namespace ExamplePointerEventRecording;
+
+	FExampleRecordedPointerEvent Event;
+	Event.TimeMicroseconds = InTimeMicroseconds;
+	Event.Type = InType;
+	Event.ScreenSpacePosition = InEvent.GetScreenSpacePosition();
+	Event.EffectingButton = GetButtonIndex(InEvent.GetEffectingButton());
+	Event.PointerIndex = static_cast<uint8>(InEvent.GetPointerIndex());
+	Event.UserIndex = static_cast<uint8>(InEvent.GetUserIndex());
+
+	for (int32 Index = 0; Index < NumButtons; ++Index)
+	{
+		if (InEvent.IsMouseButtonDown(GetButtonKey(Index)))
+		{
+			Event.PressedButtons |= 1 << Index;
+		}
+	}
+
+	const FModifierKeysState& Modifiers = InEvent.GetModifierKeys();
+	const bool ModifierBits[] =
+	{
+		Modifiers.IsLeftShiftDown(), Modifiers.IsRightShiftDown(),
+		Modifiers.IsLeftControlDown(), Modifiers.IsRightControlDown(),
+		Modifiers.IsLeftAltDown(), Modifiers.IsRightAltDown(),
+		Modifiers.IsLeftCommandDown(), Modifiers.IsRightCommandDown(),
+		Modifiers.AreCapsLocked()
+	};
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(ModifierBits); ++Index)
+	{
+		if (ModifierBits[Index])
+		{
+			Event.ModifierKeys |= 1 << Index;
+		}
+	}
+
+	return Event;
+}
+
+FPointerEvent FExampleRecordedPointerEvent::ToPointerEvent(const FVector2D& LastScreenSpacePosition) const
+{
+	using namespace ExamplePointerEventRecording;
+
+	TSet<FKey> PressedKeys;
+	for (int32 Index = 0; Index < NumButtons; ++Index)
+	{
+		if (PressedButtons & (1 << Index))
+		{
+			PressedKeys.Add(GetButtonKey(Index));
+		}
+	}
+
+	const FKey EffectingKey = EffectingButton < NumButtons ? GetButtonKey(EffectingButton) : EKeys::Invalid;
+
+	auto IsModifierDown = [this](int32 Bit) { return (ModifierKeys & (1 << Bit)) != 0; };
+	const FModifierKeysState Modifiers(
+		IsModifierDown(0), IsModifierDown(1),
+		IsModifierDown(2), IsModifierDown(3),
+		IsModifierDown(4), IsModifierDown(5),
+		IsModifierDown(6), IsModifierDown(7),
+		IsModifierDown(8));
+
+	return FPointerEvent(UserIndex, PointerIndex, ScreenSpacePosition, LastScreenSpacePosition, PressedKeys, EffectingKey, 0.0f, Modifiers);
+}
+
+FArchive& operator<<(FArchive& Ar, FExampleRecordedPointerEvent& Event)
+{
+	Ar << Event.TimeMicroseconds;
+	Ar << Event.Type;
+	Ar << Event.ScreenSpacePosition.X;
+	Ar << Event.ScreenSpacePosition.Y;
+	Ar << Event.EffectingButton;
+	Ar << Event.PressedButtons;
+	Ar << Event.ModifierKeys;
+	Ar << Event.PointerIndex;
+	Ar << Event.UserIndex;
+	return Ar;
+}
+
+/*************************RECORDING***************************/
+
+bool FExamplePointerRecording::SaveToFile(const FString& Filename) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = ExamplePointerEventRecording::FileMagic;
+	uint16 Version = ExamplePointerEventRecording::FileVersion;
+	int32 NumEvents = Events.Num();
+	Writer << Magic << Version << NumEvents;
+
+	for (FExampleRecordedPointerEvent Event : Events)
+	{
+		Writer << Event;
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+bool FExamplePointerRecording::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	int32 NumEvents = 0;
+	Reader << Magic << Version << NumEvents;
+
+	if (Reader.IsError() || Magic != ExamplePointerEventRecording::FileMagic || Version != ExamplePointerEventRecording::FileVersion || NumEvents < 0)
+	{
+		return false;
+	}
+
+	// Don't trust the count until we know the file actually has that many events in it,
+	// a corrupt or cut off file would otherwise have us allocating whatever it says
+	if (NumEvents * ExamplePointerEventRecording::SerializedEventSize > Reader.TotalSize() - Reader.Tell())
+	{
+		return false;
+	}
+
+	Events.SetNum(NumEvents);
+	for (FExampleRecordedPointerEvent& Event : Events)
+	{
+		Reader << Event;
+	}
+
+	if (Reader.IsError())
+	{
+		Events.Reset();
+		return false;
+	}
+	return true;
+}
+
+/*************************RECORDER***************************/
+
+void FExamplePointerEventRecorder::Start()
+{
+	Recording.Events.Reset();
+	StartTime = FPlatformTime::Seconds();
+	bRecording = true;
+}
+
+void FExamplePointerEventRecorder::Stop()
+{
+	bRecording = false;
+}
+
+bool FExamplePointerEventRecorder::HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	Record(EExamplePointerEventType::Move, MouseEvent);
+
+	// We're only listening, so let the event carry on to the widgets
+	return false;
+}
+
+bool FExamplePointerEventRecorder::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	Record(EExamplePointerEventType::ButtonDown, MouseEvent);
+	return false;
+}
+
+bool FExamplePointerEventRecorder::HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	Record(EExamplePointerEventType::ButtonUp, MouseEvent);
+	return false;
+}
+
+bool FExamplePointerEventRecorder::HandleMouseButtonDoubleClickEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	Record(EExamplePointerEventType::DoubleClick, MouseEvent);
+	return false;
+}
+
+void FExamplePointerEventRecorder::Record(EExamplePointerEventType Type, const FPointerEvent& MouseEvent)
+{
+	// Don't record what a replay is feeding in
+	if (!bRecording || FExamplePointerEventReplayer::IsInjecting())
+	{
+		return;
+	}
+
+	const uint32 TimeMicroseconds = static_cast<uint32>((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+	Recording.Events.Add(FExampleRecordedPointerEvent::FromPointerEvent(Type, MouseEvent, TimeMicroseconds));
+}
+
+/*************************REPLAYER***************************/
+
+bool FExamplePointerEventReplayer::bInjecting = false;
+
+FExamplePointerEventReplayer::~FExamplePointerEventReplayer()
+{
+	Stop();
+}
+
+void FExamplePointerEventReplayer::Start(const FExamplePointerRecording& InRecording, float InRate)
+{
+	Stop();
+
+	Recording = InRecording;
+	Rate = FMath::Max(InRate, 0.0f);
+	ElapsedSeconds = 0.0;
+	NextEvent = 0;
+	HandlingCycles = 0;
+	LastPosition = Recording.Events.Num() > 0 ? Recording.Events[0].ScreenSpacePosition : FVector2D::ZeroVector;
+
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FExamplePointerEventReplayer::Tick));
+}
+
+void FExamplePointerEventReplayer::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+bool FExamplePointerEventReplayer::Tick(float DeltaTime)
+{
+	if (!FSlateApplication::IsInitialized())
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+
+	ElapsedSeconds += DeltaTime * Rate;
+	const uint64 ElapsedMicroseconds = static_cast<uint64>(ElapsedSeconds * 1000000.0);
+
+	// Feed in every event that's due, always in recorded order so the results are the same every time
+	while (Recording.Events.IsValidIndex(NextEvent) && (Rate == 0.0f || Recording.Events[NextEvent].TimeMicroseconds <= ElapsedMicroseconds))
+	{
+		Inject(Recording.Events[NextEvent]);
+		++NextEvent;
+	}
+
+	if (NextEvent >= Recording.Events.Num())
+	{
+		const double HandlingMs = FPlatformTime::ToMilliseconds64(HandlingCycles);
+		UE_LOG(LogSlate, Display, TEXT("Pointer replay finished: %d events, %.3fms handling in total, %.4fms per event"),
+			Recording.Events.Num(), HandlingMs, Recording.Events.Num() > 0 ? HandlingMs / Recording.Events.Num() : 0.0);
+
+		// Returning false removes us from the ticker
+		TickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FExamplePointerEventReplayer::Inject(const FExampleRecordedPointerEvent& Event)
+{
+	FSlateApplication& SlateApp = FSlateApplication::Get();
+	const FPointerEvent PointerEvent = Event.ToPointerEvent(LastPosition);
+	LastPosition = Event.ScreenSpacePosition;
+
+	TGuardValue<bool> InjectingGuard(bInjecting, true);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	switch (Event.Type)
+	{
+	case EExamplePointerEventType::Move:
+		SlateApp.ProcessMouseMoveEvent(PointerEvent);
+		break;
+	case EExamplePointerEventType::ButtonDown:
+		SlateApp.ProcessMouseButtonDownEvent(nullptr, PointerEvent);
+		break;
+	case EExamplePointerEventType::ButtonUp:
+		SlateApp.ProcessMouseButtonUpEvent(PointerEvent);
+		break;
+	case EExamplePointerEventType::DoubleClick:
+		SlateApp.ProcessMouseButtonDoubleClickEvent(nullptr, PointerEvent);
+		break;
+	}
+
+	HandlingCycles += FPlatformTime::Cycles64() - StartCycles;
+}
+
+/*************************CONSOLE COMMANDS***************************/
+
+static FAutoConsoleCommand ExamplePointerRecordCommand(
+	TEXT("ExampleUI.Pointer.Record"),
+	TEXT("Starts recording pointer events. Usage: ExampleUI.Pointer.Record <File>"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		using namespace ExamplePointerEventRecording;
+
+		if (Args.Num() < 1 || !FSlateApplication::IsInitialized())
+		{
+			return;
+		}
+
+		if (!ConsoleRecorder.IsValid())
+		{
+			ConsoleRecorder = MakeShared<FExamplePointerEventRecorder>();
+			FSlateApplication::Get().RegisterInputPreProcessor(ConsoleRecorder);
+		}
+
+		ConsoleRecordingFilename = Args[0];
+		ConsoleRecorder->Start();
+	}));
+
+static FAutoConsoleCommand ExamplePointerStopRecordingCommand(
+	TEXT("ExampleUI.Pointer.StopRecording"),
+	TEXT("Stops recording pointer events and saves them to the file given to ExampleUI.Pointer.Record."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		using namespace ExamplePointerEventRecording;
+
+		if (!ConsoleRecorder.IsValid())
+		{
+			return;
+		}
+
+		ConsoleRecorder->Stop();
+		if (FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().UnregisterInputPreProcessor(ConsoleRecorder);
+		}
+
+		const FExamplePointerRecording& Recording = ConsoleRecorder->GetRecording();
+		if (Recording.SaveToFile(ConsoleRecordingFilename))
+		{
+			UE_LOG(LogSlate, Display, TEXT("Saved %d pointer events to %s"), Recording.Events.Num(), *ConsoleRecordingFilename);
+		}
+		else
+		{
+			UE_LOG(LogSlate, Error, TEXT("Failed to save pointer events to %s"), *ConsoleRecordingFilename);
+		}
+
+		ConsoleRecorder.Reset();
+	}));
+
+static FAutoConsoleCommand ExamplePointerReplayCommand(
+	TEXT("ExampleUI.Pointer.Replay"),
+	TEXT("Replays recorded pointer events. Usage: ExampleUI.Pointer.Replay <File> [Rate], a rate of 0 injects everything at once"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		using namespace ExamplePointerEventRecording;
+
+		FExamplePointerRecording Recording;
+		if (Args.Num() < 1 || !Recording.LoadFromFile(Args[0]))
+		{
+			UE_LOG(LogSlate, Error, TEXT("ExampleUI.Pointer.Replay: couldn't load a recording from '%s'"), Args.Num() > 0 ? *Args[0] : TEXT(""));
+			return;
+		}
+
+		if (!ConsoleReplayer.IsValid())
+		{
+			ConsoleReplayer = MakeUnique<FExamplePointerEventReplayer>();
+		}
+		ConsoleReplayer->Start(Recording, Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.0f);
+	}));
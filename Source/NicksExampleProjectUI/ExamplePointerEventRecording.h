@@ -0,0 +1,135 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Framework/Application/IInputProcessor.h"
+
+/** The kind of pointer event that was recorded */
+enum class EExamplePointerEventType : uint8
+{
+	Move,
+	ButtonDown,
+	ButtonUp,
+	DoubleClick,
+};
+
+/** One recorded pointer event, kept small so long recordings stay compact on disk(19 bytes each) */
+struct NICKSEXAMPLEPROJECTUI_API FExampleRecordedPointerEvent
+{
+	/** Microseconds since the recording started */
+	uint32 TimeMicroseconds = 0;
+
+	EExamplePointerEventType Type = EExamplePointerEventType::Move;
+
+	FVector2D ScreenSpacePosition = FVector2D::ZeroVector;
+
+	/** Index into our mouse button table, or 0xFF if no button caused this event */
+	uint8 EffectingButton = 0xFF;
+
+	/** Bit mask of the mouse buttons(same table) that were held down */
+	uint8 PressedButtons = 0;
+
+	/** Bit mask of the modifier keys that were held down */
+	uint16 ModifierKeys = 0;
+
+	uint8 PointerIndex = 0;
+	uint8 UserIndex = 0;
+
+	/** Builds a record from a slate pointer event */
+	static FExampleRecordedPointerEvent FromPointerEvent(EExamplePointerEventType InType, const FPointerEvent& InEvent, uint32 InTimeMicroseconds);
+
+	/** Rebuilds the slate pointer event, we don't record the last position since its just the previous event's position */
+	FPointerEvent ToPointerEvent(const FVector2D& LastScreenSpacePosition) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FExampleRecordedPointerEvent& Event);
+};
+
+/** A recorded stream of pointer events */
+struct NICKSEXAMPLEPROJECTUI_API FExamplePointerRecording
+{
+	TArray<FExampleRecordedPointerEvent> Events;
+
+	/** Saves/loads the recording in our binary format, returns false if the file couldn't be written/read or isn't a recording */
+	bool SaveToFile(const FString& Filename) const;
+	bool LoadFromFile(const FString& Filename);
+};
+
+/**
+ * Records every pointer event slate receives, it runs as an input pre-processor so it sees the events before any widget does.
+ * Start and stop it with "ExampleUI.Pointer.Record <File>" and "ExampleUI.Pointer.StopRecording".
+ */
+class NICKSEXAMPLEPROJECTUI_API FExamplePointerEventRecorder : public IInputProcessor
+{
+public:
+
+	/** Starts recording, call Stop to get the recording back */
+	void Start();
+	void Stop();
+
+	bool IsRecording() const { return bRecording; }
+	const FExamplePointerRecording& GetRecording() const { return Recording; }
+
+	//~ Begin IInputProcessor Interface
+	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override {}
+	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseButtonDoubleClickEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	//~ End IInputProcessor Interface
+
+private:
+
+	void Record(EExamplePointerEventType Type, const FPointerEvent& MouseEvent);
+
+	FExamplePointerRecording Recording;
+	double StartTime = 0.0;
+	bool bRecording = false;
+};
+
+/**
+ * Injects a recording back into slate in exactly the recorded order, so hover/click handling and hit-testing can be benchmarked
+ * without a human moving the mouse. Events go through FSlateApplication just like real ones do.
+ * Start it with "ExampleUI.Pointer.Replay <File> [Rate]".
+ */
+class NICKSEXAMPLEPROJECTUI_API FExamplePointerEventReplayer
+{
+public:
+
+	~FExamplePointerEventReplayer();
+
+	/**
+	 * Starts replaying.
+	 *
+	 * @param InRecording	The events to inject
+	 * @param InRate		1 replays at the recorded timing, 2 twice as fast...etc, 0 injects everything on the first tick
+	 */
+	void Start(const FExamplePointerRecording& InRecording, float InRate);
+	void Stop();
+
+	bool IsReplaying() const { return TickerHandle.IsValid(); }
+
+	/** Whether or not the events slate is currently processing came from a replay(so the recorder can ignore them) */
+	static bool IsInjecting() { return bInjecting; }
+
+private:
+
+	bool Tick(float DeltaTime);
+
+	/** Sends a single event to slate */
+	void Inject(const FExampleRecordedPointerEvent& Event);
+
+	FExamplePointerRecording Recording;
+	FDelegateHandle TickerHandle;
+
+	float Rate = 1.0f;
+	double ElapsedSeconds = 0.0;
+	int32 NextEvent = 0;
+	FVector2D LastPosition = FVector2D::ZeroVector;
+
+	/** Time spent inside of slate handling the injected events */
+	uint64 HandlingCycles = 0;
+
+	static bool bInjecting;
+};
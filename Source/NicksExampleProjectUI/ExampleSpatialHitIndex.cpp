@@ -0,0 +1,128 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleSpatialHitIndex.h"
+
+FExampleSpatialHitIndex::FExampleSpatialHitIndex(float InBucketSize)
+	: BucketSize(FMath::Max(InBucketSize, 1.0f))
+{
+}
+
+FIntRect FExampleSpatialHitIndex::GetBucketRange(const FSlateRect& InRect) const
+{
+	// Inclusive on both ends
+	return FIntRect(
+		FMath::FloorToInt(InRect.Left / BucketSize),
+		FMath::FloorToInt(InRect.Top / BucketSize),
+		FMath::FloorToInt(InRect.Right / BucketSize),
+		FMath::FloorToInt(InRect.Bottom / BucketSize));
+}
+
+void FExampleSpatialHitIndex::AddToBuckets(int32 InId, const FIntRect& InRange)
+{
+	for (int32 Y = InRange.Min.Y; Y <= InRange.Max.Y; ++Y)
+	{
+		for (int32 X = InRange.Min.X; X <= InRange.Max.X; ++X)
+		{
+			Buckets.FindOrAdd(FIntPoint(X, Y)).Add(InId);
+		}
+	}
+}
+
+void FExampleSpatialHitIndex::RemoveFromBuckets(int32 InId, const FIntRect& InRange)
+{
+	for (int32 Y = InRange.Min.Y; Y <= InRange.Max.Y; ++Y)
+	{
+		for (int32 X = InRange.Min.X; X <= InRange.Max.X; ++X)
+		{
+			const FIntPoint Key(X, Y);
+			if (TArray<int32>* Bucket = Buckets.Find(Key))
+			{
+				Bucket->RemoveSingleSwap(InId, false);
+				if (Bucket->Num() == 0)
+				{
+					Buckets.Remove(Key);
+				}
+			}
+		}
+	}
+}
+
+void FExampleSpatialHitIndex::Update(int32 InId, const FSlateRect& InRect)
+{
+	check(InId >= 0);
+
+	if (Rects.Num() <= InId)
+	{
+		Rects.SetNum(InId + 1);
+		InIndex.Add(false, InId + 1 - InIndex.Num());
+	}
+
+	if (InIndex[InId])
+	{
+		// Nothing moved, which is what happens almost every frame
+		if (Rects[InId] == InRect)
+		{
+			return;
+		}
+
+		// Still in the same buckets, we only need to remember the new rectangle
+		const FIntRect OldRange = GetBucketRange(Rects[InId]);
+		const FIntRect NewRange = GetBucketRange(InRect);
+		Rects[InId] = InRect;
+		if (OldRange == NewRange)
+		{
+			return;
+		}
+
+		RemoveFromBuckets(InId, OldRange);
+		AddToBuckets(InId, NewRange);
+		++NumRebuckets;
+		return;
+	}
+
+	Rects[InId] = InRect;
+	InIndex[InId] = true;
+	AddToBuckets(InId, GetBucketRange(InRect));
+	++NumRebuckets;
+}
+
+void FExampleSpatialHitIndex::Remove(int32 InId)
+{
+	if (Contains(InId))
+	{
+		RemoveFromBuckets(InId, GetBucketRange(Rects[InId]));
+		InIndex[InId] = false;
+		++NumRebuckets;
+	}
+}
+
+void FExampleSpatialHitIndex::Reset()
+{
+	Buckets.Reset();
+	Rects.Reset();
+	InIndex.Reset();
+	NumRebuckets = 0;
+}
+
+int32 FExampleSpatialHitIndex::FindAt(const FVector2D& InPoint) const
+{
+	const FIntPoint Key(FMath::FloorToInt(InPoint.X / BucketSize), FMath::FloorToInt(InPoint.Y / BucketSize));
+	const TArray<int32>* Bucket = Buckets.Find(Key);
+	if (!Bucket)
+	{
+		return INDEX_NONE;
+	}
+
+	// Buckets aren't kept in any order, so find the highest(top most) id that contains the point
+	int32 FoundId = INDEX_NONE;
+	for (const int32 Id : *Bucket)
+	{
+		const FSlateRect& Rect = Rects[Id];
+		if (Id > FoundId && InPoint.X >= Rect.Left && InPoint.X < Rect.Right && InPoint.Y >= Rect.Top && InPoint.Y < Rect.Bottom)
+		{
+			FoundId = Id;
+		}
+	}
+	return FoundId;
+}
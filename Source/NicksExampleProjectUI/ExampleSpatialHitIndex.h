@@ -0,0 +1,59 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Layout/SlateRect.h"
+
+/**
+ * A uniform grid of buckets over absolute(window) space used to find which of many rectangles a point is in without checking all of them.
+ * Each rectangle has an id, a higher id means it was painted later and so it's on top.
+ *
+ * Updates are incremental, giving an id the same rectangle again costs nothing and moving it only touches the buckets it left and entered.
+ * Lookups only check the rectangles in one bucket, so with evenly sized rectangles a lookup takes about the same time no matter how many there are.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleSpatialHitIndex
+{
+public:
+
+	/** @param InBucketSize	The size of a bucket in slate units, roughly the size of the rectangles going in works best */
+	explicit FExampleSpatialHitIndex(float InBucketSize = 64.0f);
+
+	/** Adds or moves the rectangle with the given id */
+	void Update(int32 InId, const FSlateRect& InRect);
+
+	/** Takes the rectangle with the given id out of the index */
+	void Remove(int32 InId);
+
+	/** Takes everything out of the index */
+	void Reset();
+
+	/** Returns the id of the top most rectangle containing the point, or INDEX_NONE if there isn't one */
+	int32 FindAt(const FVector2D& InPoint) const;
+
+	/** The rectangle stored for an id, only valid if Contains(InId) */
+	const FSlateRect& GetRect(int32 InId) const { return Rects[InId]; }
+	bool Contains(int32 InId) const { return InIndex.IsValidIndex(InId) && InIndex[InId]; }
+
+	/** How many times a rectangle had to be moved between buckets since the last Reset, handy for seeing how incremental our updates are */
+	int32 GetNumRebuckets() const { return NumRebuckets; }
+
+private:
+
+	/** The range of buckets a rectangle overlaps */
+	FIntRect GetBucketRange(const FSlateRect& InRect) const;
+
+	void AddToBuckets(int32 InId, const FIntRect& InRange);
+	void RemoveFromBuckets(int32 InId, const FIntRect& InRange);
+
+	float BucketSize;
+
+	/** Which ids are in each bucket, only buckets with something in them exist */
+	TMap<FIntPoint, TArray<int32>> Buckets;
+
+	/** The rectangle of each id and whether that id is in the index at all */
+	TArray<FSlateRect> Rects;
+	TBitArray<> InIndex;
+
+	int32 NumRebuckets = 0;
+};
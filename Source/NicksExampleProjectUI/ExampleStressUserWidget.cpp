@@ -0,0 +1,40 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ExampleStressUserWidget.h"
+#include "ExampleBorder.h"
+#include "Blueprint/WidgetTree.h"
+
+UExampleStressUserWidget::UExampleStressUserWidget(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	
+}
+
+TSharedRef<SWidget> UExampleStressUserWidget::RebuildWidget()
+{
+	// Native user widgets get an empty widget tree, so we fill it in ourselves
+	if (WidgetTree && !WidgetTree->RootWidget)
+	{
+		UExampleBorder* ParentBorder = nullptr;
+		for (int32 Depth = 0; Depth < FMath::Max(TreeDepth, 1); ++Depth)
+		{
+			UExampleBorder* NewBorder = WidgetTree->ConstructWidget<UExampleBorder>(UExampleBorder::StaticClass());
+			Borders.Add(NewBorder);
+
+			// The first border is our root, every other one goes inside of the one before it
+			if (ParentBorder)
+			{
+				ParentBorder->SetContent(NewBorder);
+			}
+			else
+			{
+				WidgetTree->RootWidget = NewBorder;
+			}
+			ParentBorder = NewBorder;
+		}
+
+		// This is the border our parent class changes the color of
+		Border = Borders[0];
+	}
+
+	return Super::RebuildWidget();
+}
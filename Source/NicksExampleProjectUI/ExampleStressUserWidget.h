@@ -0,0 +1,39 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExampleUserWidget.h"
+#include "ExampleStressUserWidget.generated.h"
+
+/**
+ * A user widget that builds its own tree of nested UExampleBorders in C++, so the stress tests
+ * don't depend on any widget blueprint content.
+ */
+UCLASS()
+class NICKSEXAMPLEPROJECTUI_API UExampleStressUserWidget : public UExampleUserWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Ctor */
+	UExampleStressUserWidget(const FObjectInitializer& ObjectInitializer);
+
+	/** How many borders get nested inside of each other, has to be set before the widget gets built */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress")
+	int32 TreeDepth = 4;
+
+	/** All of the borders in our tree, outermost first */
+	const TArray<UExampleBorder*>& GetBorders() const { return Borders; }
+
+protected:
+
+	//~ Begin UWidget Interface
+	/** Here we build our border tree the first time we're asked for our slate widget */
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	//~ End UWidget Interface
+
+	UPROPERTY(Transient)
+	TArray<UExampleBorder*> Borders;
+};
@@ -0,0 +1,180 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleSyncScheduler.h"
+#include "Containers/Ticker.h"
+#include "ExampleBorder.h"
+#include "ExampleUIStats.h"
+
+static int32 GExampleSyncTimeSlice = 1;
+static FAutoConsoleVariableRef CVarExampleSyncTimeSlice(
+	TEXT("ExampleUI.Sync.TimeSlice"),
+	GExampleSyncTimeSlice,
+	TEXT("Lets borders with a High or Low sync priority synchronize their properties over multiple frames. When off everything synchronizes right away."));
+
+static float GExampleSyncBudgetMs = 2.0f;
+static FAutoConsoleVariableRef CVarExampleSyncBudgetMs(
+	TEXT("ExampleUI.Sync.BudgetMs"),
+	GExampleSyncBudgetMs,
+	TEXT("How many milliseconds per frame can be spent synchronizing deferred borders."));
+
+static FAutoConsoleCommandWithOutputDevice ExampleSyncStatsCommand(
+	TEXT("ExampleUI.Sync.Stats"),
+	TEXT("Prints how many border synchronizations have been spread across frames."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		FExampleSyncScheduler::Get().DumpStats(Ar);
+	}));
+
+static FAutoConsoleCommand ExampleSyncFlushCommand(
+	TEXT("ExampleUI.Sync.Flush"),
+	TEXT("Synchronizes every deferred border right now."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FExampleSyncScheduler::Get().Flush();
+	}));
+
+FExampleSyncScheduler& FExampleSyncScheduler::Get()
+{
+	static FExampleSyncScheduler Instance;
+	return Instance;
+}
+
+bool FExampleSyncScheduler::IsEnabled()
+{
+	return GExampleSyncTimeSlice != 0;
+}
+
+void FExampleSyncScheduler::Schedule(UExampleBorder* InBorder)
+{
+	check(IsInGameThread());
+
+	if (!InBorder || InBorder->bSyncPending)
+	{
+		return;
+	}
+
+	InBorder->bSyncPending = true;
+	Pending.Add(InBorder);
+
+	// We only sit on the ticker while there's something to do
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FExampleSyncScheduler::Tick));
+	}
+}
+
+void FExampleSyncScheduler::Flush()
+{
+	// Synchronizing can schedule more borders(e.g. new content), so keep going until we're done
+	while (Pending.Num() > 0)
+	{
+		TArray<TWeakObjectPtr<UExampleBorder>> ToSync = MoveTemp(Pending);
+		for (const TWeakObjectPtr<UExampleBorder>& Border : ToSync)
+		{
+			if (UExampleBorder* BorderPtr = Border.Get())
+			{
+				BorderPtr->RunDeferredSync();
+				++TotalSynced;
+			}
+		}
+	}
+}
+
+void FExampleSyncScheduler::FlushBorder(UExampleBorder* InBorder)
+{
+	if (!InBorder || !InBorder->IsSyncPending())
+	{
+		return;
+	}
+
+	// Keep the order of everything else, it's already sorted the way we like
+	Pending.RemoveSingle(InBorder);
+	InBorder->RunDeferredSync();
+	++TotalSynced;
+}
+
+void FExampleSyncScheduler::SortPending()
+{
+	// Lower scores go first: anything on screen before anything that isn't, then High before Low.
+	// There's only a handful of scores, so every border gets scored once and dropped in its score's bucket,
+	// which keeps borders with the same score in the order they were scheduled in
+	for (TArray<TWeakObjectPtr<UExampleBorder>>& Bucket : SortBuckets)
+	{
+		Bucket.Reset();
+	}
+
+	for (TWeakObjectPtr<UExampleBorder>& Border : Pending)
+	{
+		const UExampleBorder* BorderPtr = Border.Get();
+		if (!BorderPtr)
+		{
+			continue; // Dead ones just get dropped
+		}
+
+		// If we've been laid out with a size then we're on screen(or close to it)
+		const bool bOnScreen = BorderPtr->IsVisible() && !BorderPtr->GetCachedGeometry().GetLocalSize().IsNearlyZero();
+		const bool bLowPriority = BorderPtr->SyncPriority == EExampleBorderSyncPriority::Low;
+		SortBuckets[(bOnScreen ? 0 : 2) + (bLowPriority ? 1 : 0)].Add(MoveTemp(Border));
+	}
+
+	Pending.Reset();
+	for (TArray<TWeakObjectPtr<UExampleBorder>>& Bucket : SortBuckets)
+	{
+		Pending.Append(Bucket);
+	}
+}
+
+bool FExampleSyncScheduler::Tick(float DeltaTime)
+{
+	// Sorting comes out of our budget too
+	const double StartTime = FPlatformTime::Seconds();
+	const double EndTime = StartTime + GExampleSyncBudgetMs / 1000.0;
+
+	SortPending();
+
+	int32 NumProcessed = 0;
+	uint32 NumSynced = 0;
+	while (NumProcessed < Pending.Num())
+	{
+		UExampleBorder* Border = Pending[NumProcessed].Get();
+		++NumProcessed;
+
+		if (Border)
+		{
+			Border->RunDeferredSync();
+			++NumSynced;
+
+			// Always do at least one so we never get stuck
+			if (FPlatformTime::Seconds() >= EndTime)
+			{
+				break;
+			}
+		}
+	}
+
+	// Anything synchronizing scheduled got added to the end, so removing from the front is safe
+	Pending.RemoveAt(0, NumProcessed, false);
+
+	const double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	TotalSynced += NumSynced;
+	++TotalFrames;
+	MostSyncedInAFrame = FMath::Max(MostSyncedInAFrame, NumSynced);
+	MostMsInAFrame = FMath::Max(MostMsInAFrame, FrameMs);
+	INC_DWORD_STAT_BY(STAT_ExampleDeferredBorderSyncs, NumSynced);
+
+	if (Pending.Num() == 0)
+	{
+		// Returning false removes us from the ticker
+		TickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FExampleSyncScheduler::DumpStats(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Example sync scheduler: %s, %.2fms budget, %d borders pending"), IsEnabled() ? TEXT("on") : TEXT("off"), GExampleSyncBudgetMs, Pending.Num());
+	Ar.Logf(TEXT("  %u borders synchronized over %u frames, at most %u(%.3fms) in a single frame"), TotalSynced, TotalFrames, MostSyncedInAFrame, MostMsInAFrame);
+}
@@ -0,0 +1,73 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "ExampleSyncScheduler.generated.h"
+
+class UExampleBorder;
+
+/** How soon a border's properties get pushed to its slate widget */
+UENUM(BlueprintType)
+enum class EExampleBorderSyncPriority : uint8
+{
+	/** Synchronized right away, like any other widget */
+	Immediate,
+	/** Synchronized over the next few frames, before any Low priority borders */
+	High,
+	/** Synchronized over the next few frames whenever there's time left */
+	Low,
+};
+
+/**
+ * Spreads the SynchronizeProperties work of non-Immediate borders across frames so opening(or restyling) a big menu
+ * doesn't do all of it in one frame. Every frame pending borders get synchronized until "ExampleUI.Sync.BudgetMs" is used up,
+ * borders that are visible on screen go first, then High priority before Low. At least one border is synchronized per frame so we always make progress.
+ * Game thread only.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleSyncScheduler
+{
+public:
+
+	static FExampleSyncScheduler& Get();
+
+	/** Whether or not borders are allowed to defer their synchronization at all("ExampleUI.Sync.TimeSlice") */
+	static bool IsEnabled();
+
+	/** Queues a border to be synchronized in a later frame, does nothing if its already queued */
+	void Schedule(UExampleBorder* InBorder);
+
+	/** Synchronizes everything that's pending right now, ignoring the budget */
+	void Flush();
+
+	/** Synchronizes a single border right now if it's waiting to be, for when that one border can't wait */
+	void FlushBorder(UExampleBorder* InBorder);
+
+	/** How many borders are waiting to be synchronized */
+	int32 GetNumPending() const { return Pending.Num(); }
+
+	/** Prints how much work the scheduler has been spreading out */
+	void DumpStats(FOutputDevice& Ar) const;
+
+private:
+
+	/** Synchronizes pending borders until we run out of budget, returns false(removing us from the ticker) once nothing is left */
+	bool Tick(float DeltaTime);
+
+	/** Sorts the pending borders so the ones we want to synchronize first are at the front, dropping dead ones */
+	void SortPending();
+
+	TArray<TWeakObjectPtr<UExampleBorder>> Pending;
+
+	/** One per sort score, kept around so sorting every frame doesn't allocate */
+	TArray<TWeakObjectPtr<UExampleBorder>> SortBuckets[4];
+
+	FDelegateHandle TickerHandle;
+
+	// Some numbers for DumpStats
+	uint32 TotalSynced = 0;
+	uint32 TotalFrames = 0;
+	uint32 MostSyncedInAFrame = 0;
+	double MostMsInAFrame = 0.0;
+};
@@ -0,0 +1,154 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+// Automation tests for our UI code, run them from the session frontend(or with -ExecCmds="Automation RunTests NicksExampleProject.UI").
+// The benchmarks that just report numbers are console commands in ExampleUIBenchmarks.cpp, these are the ones with a pass or fail.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "Application/SlateApplicationBase.h"
+#include "UObject/Package.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/SWindow.h"
+#include "ExampleBorder.h"
+#include "ExampleHeadlessPainter.h"
+#include "ExampleUIStats.h"
+#include "SExampleBorder.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ExampleUIAutomationTests
+{
+	/** Paints the given number of frames of a window and returns how many border paints and prepasses they took */
+	static void PaintWindowAndCount(FExampleHeadlessPainter& Painter, const TSharedRef<SWindow>& Window, int32 NumFrames, uint32& OutPaints, uint32& OutPrepasses)
+	{
+		FExampleUIStats::Reset();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Painter.PaintWindow(Window);
+		}
+		OutPaints = FExampleUIStats::BorderPaints;
+		OutPrepasses = FExampleUIStats::BorderPrepasses;
+	}
+}
+
+/**
+ * Builds a tree of nested borders in a window painted with global invalidation on(the window is the invalidation root) and checks that:
+ * - frames where nothing changed don't paint or prepass a single border
+ * - a color change only repaints, a padding change does a prepass
+ * - a UExampleBorder brush changed in place(same brush pointer, different contents) repaints
+ * - a border with a bound color is volatile and gets repainted every frame
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExampleBorderStaticTreeTest, "NicksExampleProject.UI.Invalidation.StaticBorderTree",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FExampleBorderStaticTreeTest::RunTest(const FString& Parameters)
+{
+	using namespace ExampleUIAutomationTests;
+
+	const int32 NumBorders = 200;
+	const int32 NumFrames = 10;
+
+	// Windows can only be painted with slate up, failing beats passing without having checked anything
+	if (!FSlateApplicationBase::IsInitialized())
+	{
+		AddError(TEXT("Slate isn't initialized, the border tree can't be painted through a window"));
+		return false;
+	}
+
+	// The window only takes the fast path with global invalidation on, put it back how we found it when we're done. Set as if
+	// from the console so it wins over however it was set before
+	IConsoleVariable* GlobalInvalidation = IConsoleManager::Get().FindConsoleVariable(TEXT("Slate.EnableGlobalInvalidation"));
+	if (!GlobalInvalidation)
+	{
+		AddError(TEXT("Slate.EnableGlobalInvalidation doesn't exist"));
+		return false;
+	}
+	const bool bGlobalInvalidationWasOn = GlobalInvalidation->GetBool();
+	GlobalInvalidation->Set(true, ECVF_SetByConsole);
+
+	FExampleHeadlessPainter::EnsureSlateStyle();
+
+	TArray<TSharedRef<SExampleBorder>> Borders;
+	TSharedRef<SVerticalBox> Box = SNew(SVerticalBox);
+	for (int32 Index = 0; Index < NumBorders / 2; ++Index)
+	{
+		TSharedRef<SExampleBorder> Inner = SNew(SExampleBorder);
+		TSharedRef<SExampleBorder> Outer = SNew(SExampleBorder)
+		[
+			Inner
+		];
+
+		Box->AddSlot()
+		.AutoHeight()
+		[
+			Outer
+		];
+
+		Borders.Add(Outer);
+		Borders.Add(Inner);
+	}
+
+	// A UMG border as well, it hands its slate widget a pointer to its own brush and changes that brush in place
+	UExampleBorder* UMGBorder = NewObject<UExampleBorder>(GetTransientPackage());
+	Box->AddSlot()
+	.AutoHeight()
+	[
+		UMGBorder->TakeWidget()
+	];
+
+	// Never shown or added to the application, the painter paints it like the application would
+	TSharedRef<SWindow> Window = SNew(SWindow)
+		.CreateTitleBar(false)
+		.SizingRule(ESizingRule::FixedSize)
+		.ClientSize(FVector2D(1920.0f, 1080.0f))
+		[
+			Box
+		];
+
+	FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+
+	// The first couple of frames take the slow path and build the window's widget list
+	Painter.PaintWindow(Window);
+	Painter.PaintWindow(Window);
+
+	uint32 Paints = 0;
+	uint32 Prepasses = 0;
+
+	PaintWindowAndCount(Painter, Window, NumFrames, Paints, Prepasses);
+	AddInfo(FString::Printf(TEXT("%d unchanged frames: %u paints, %u prepasses"), NumFrames, Paints, Prepasses));
+	TestEqual(TEXT("Border paints over unchanged frames"), int32(Paints), 0);
+	TestEqual(TEXT("Border prepasses over unchanged frames"), int32(Prepasses), 0);
+
+	Borders[0]->SetBorderBackgroundColor(FLinearColor::Red);
+	PaintWindowAndCount(Painter, Window, 1, Paints, Prepasses);
+	AddInfo(FString::Printf(TEXT("Color change: %u paints, %u prepasses"), Paints, Prepasses));
+	TestTrue(TEXT("A border color change repaints"), Paints > 0);
+	TestEqual(TEXT("Border prepasses after a color change"), int32(Prepasses), 0);
+
+	Borders[0]->SetPadding(FMargin(8.0f));
+	PaintWindowAndCount(Painter, Window, 1, Paints, Prepasses);
+	AddInfo(FString::Printf(TEXT("Padding change: %u paints, %u prepasses"), Paints, Prepasses));
+	TestTrue(TEXT("A border padding change does a prepass"), Prepasses > 0);
+
+	FSlateBrush ChangedBrush = UMGBorder->GetBrush();
+	ChangedBrush.TintColor = FLinearColor::Green;
+	UMGBorder->SetBrush(ChangedBrush);
+	PaintWindowAndCount(Painter, Window, 1, Paints, Prepasses);
+	AddInfo(FString::Printf(TEXT("Brush changed in place: %u paints, %u prepasses"), Paints, Prepasses));
+	TestTrue(TEXT("Changing a border's brush in place repaints it"), Paints > 0);
+
+	// Binding an attribute makes us volatile, the frame after that is when we get picked up as such
+	Borders[1]->SetColorAndOpacity(TAttribute<FLinearColor>::Create(TAttribute<FLinearColor>::FGetter::CreateLambda([]() { return FLinearColor::White; })));
+	PaintWindowAndCount(Painter, Window, 1, Paints, Prepasses);
+	PaintWindowAndCount(Painter, Window, NumFrames, Paints, Prepasses);
+	AddInfo(FString::Printf(TEXT("Bound content color over %d frames: %u paints"), NumFrames, Paints));
+	TestTrue(TEXT("A border with a bound content color is painted every frame"), Paints >= uint32(NumFrames));
+
+	UMGBorder->ReleaseSlateResources(true);
+	GlobalInvalidation->Set(bGlobalInvalidationWasOn, ECVF_SetByConsole);
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,1230 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+// Console command benchmarks and checks for our UI code, run them from the console(or with -ExecCmds=) and the results get printed to the log.
+// Checks complain with an ensure when they fail so they show up in automated runs.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "Rendering/DrawElements.h"
+#include "UObject/Package.h"
+#include "Components/SceneComponent.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Blueprint/UserWidget.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SUniformGridPanel.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/SCanvas.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/SInvalidationPanel.h"
+#include "ExampleAllocationCounter.h"
+#include "ExampleBorder.h"
+#include "ExampleBatchAnalyzer.h"
+#include "ExampleBorderViewModel.h"
+#include "ExampleBrushPool.h"
+#include "ExampleCompactBorderTree.h"
+#include "ExampleHeadlessPainter.h"
+#include "ExampleNameplateSubsystem.h"
+#include "ExampleOverdrawAnalyzer.h"
+#include "ExampleStressUserWidget.h"
+#include "ExampleUIStats.h"
+#include "ExampleWidgetHibernation.h"
+#include "ExampleWidgetTimers.h"
+#include "TimerManager.h"
+#include "SExampleBorder.h"
+#include "SExampleBorderGrid.h"
+#include "SExampleNameplateLayer.h"
+
+// The allocation budgets default to what we counted when the pointer handlers went lazy, "ExampleUI.Alloc.CheckBudgets Record"
+// measures them again and writes what it measured to the [ConsoleVariables] section of the project's DefaultEngine.ini(which
+// overrides these defaults), check that in along with whatever changed them. Set one to -1 to stop checking it.
+//
+// SNew(SExampleBorder): 1, the shared allocation MakeShared makes for the widget
+static int32 GExampleSlateBorderConstructAllocBudget = 1;
+static FAutoConsoleVariableRef CVarExampleSlateBorderConstructAllocBudget(
+	TEXT("ExampleUI.Alloc.SlateBorderConstructBudget"),
+	GExampleSlateBorderConstructAllocBudget,
+	TEXT("The most heap allocations SNew(SExampleBorder) is allowed to make, checked by ExampleUI.Alloc.CheckBudgets(-1 to not check it)."));
+
+// UExampleBorder construct + TakeWidget: 4, the UObject itself, the slate widget and its reflection metadata(two, outside shipping).
+// One more on top of that for the UObject hash tables, which grow every so often as borders get added to them
+static int32 GExampleBorderConstructAllocBudget = 5;
+static FAutoConsoleVariableRef CVarExampleBorderConstructAllocBudget(
+	TEXT("ExampleUI.Alloc.BorderConstructBudget"),
+	GExampleBorderConstructAllocBudget,
+	TEXT("The most heap allocations creating a UExampleBorder and taking its widget(which synchronizes it) is allowed to make, checked by ExampleUI.Alloc.CheckBudgets(-1 to not check it)."));
+
+// UExampleBorder::SynchronizeProperties: 0, with nothing bound everything it passes on is a plain value
+static int32 GExampleBorderSyncAllocBudget = 0;
+static FAutoConsoleVariableRef CVarExampleBorderSyncAllocBudget(
+	TEXT("ExampleUI.Alloc.BorderSyncBudget"),
+	GExampleBorderSyncAllocBudget,
+	TEXT("The most heap allocations UExampleBorder::SynchronizeProperties is allowed to make on an already built border, checked by ExampleUI.Alloc.CheckBudgets(-1 to not check it)."));
+
+namespace ExampleUIBenchmarks
+{
+	/** Builds a Size x Size grid of cells that are each a chain of Depth borders(each one inside the one before it) */
+	static TSharedRef<SExampleBorderGrid> BuildBorderGrid(int32 Size, bool bCompactLayers, bool bUseHitTestIndex = false, int32 Depth = 2)
+	{
+		TSharedRef<SExampleBorderGrid> Grid = SNew(SExampleBorderGrid)
+			.Columns(Size)
+			.CompactLayers(bCompactLayers)
+			.UseHitTestIndex(bUseHitTestIndex);
+
+		for (int32 Index = 0; Index < Size * Size; ++Index)
+		{
+			TSharedRef<SWidget> Content = SNew(SExampleBorder);
+			for (int32 Level = 1; Level < Depth; ++Level)
+			{
+				Content = SNew(SExampleBorder)
+				[
+					Content
+				];
+			}
+
+			Grid->AddSlot()
+			[
+				Content
+			];
+		}
+		return Grid;
+	}
+
+	/** The same cells BuildBorderGrid makes, in a stock SUniformGridPanel instead of our grid */
+	static TSharedRef<SUniformGridPanel> BuildUniformBorderGrid(int32 Size, int32 Depth = 2)
+	{
+		TSharedRef<SUniformGridPanel> Grid = SNew(SUniformGridPanel);
+		for (int32 Index = 0; Index < Size * Size; ++Index)
+		{
+			TSharedRef<SWidget> Content = SNew(SExampleBorder);
+			for (int32 Level = 1; Level < Depth; ++Level)
+			{
+				Content = SNew(SExampleBorder)
+				[
+					Content
+				];
+			}
+
+			Grid->AddSlot(Index % Size, Index / Size)
+			[
+				Content
+			];
+		}
+		return Grid;
+	}
+
+	/** Lays out a grid of stress widgets(each a chain of nested borders) for the analysis commands to paint, hand OutWidgets to ReleaseStressWidgets when done */
+	static TSharedRef<SWidget> BuildStressGrid(UWorld* World, int32 NumWidgets, int32 Depth, TArray<UUserWidget*>& OutWidgets)
+	{
+		const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumWidgets)));
+		TSharedRef<SUniformGridPanel> Grid = SNew(SUniformGridPanel);
+		for (int32 Index = 0; Index < NumWidgets; ++Index)
+		{
+			UExampleStressUserWidget* Widget = CreateWidget<UExampleStressUserWidget>(World, UExampleStressUserWidget::StaticClass());
+			Widget->TreeDepth = Depth;
+
+			Grid->AddSlot(Index % Columns, Index / Columns)
+			[
+				Widget->TakeWidget()
+			];
+			OutWidgets.Add(Widget);
+		}
+		return Grid;
+	}
+
+	/** Throws out the slate widgets of the stress widgets BuildStressGrid made, so nothing but the garbage collector holds on to them */
+	static void ReleaseStressWidgets(TArray<UUserWidget*>& Widgets)
+	{
+		for (UUserWidget* Widget : Widgets)
+		{
+			Widget->ReleaseSlateResources(true);
+		}
+		Widgets.Empty();
+	}
+
+	/**
+	 * Gives NumBorders borders one of NumBrushes brushes each through SetBrush and reports how much brush data they share through
+	 * the pool, per 1000 borders. Checks they all still draw the brush they were given, and that the pool lets go of the brushes
+	 * once the borders are gone.
+	 */
+	static bool RunBrushInterning(int32 NumBorders, int32 NumBrushes, FOutputDevice& Ar)
+	{
+		FExampleBrushPool& Pool = FExampleBrushPool::Get();
+		const int32 UniqueBefore = Pool.GetNumUniqueBrushes();
+		const SIZE_T PoolBytesBefore = Pool.GetAllocatedSize();
+
+		TArray<FSlateBrush> Brushes;
+		for (int32 Index = 0; Index < NumBrushes; ++Index)
+		{
+			// Tints nothing else in the pool would have, so every one of these is a new pooled brush
+			FSlateBrush& Brush = Brushes.AddDefaulted_GetRef();
+			Brush.TintColor = FLinearColor(0.123f, 0.456f, float(Index) / NumBrushes, 0.789f);
+		}
+
+		TArray<UExampleBorder*> Borders;
+		Borders.Reserve(NumBorders);
+		bool bPassed = true;
+		for (int32 Index = 0; Index < NumBorders; ++Index)
+		{
+			UExampleBorder* Border = NewObject<UExampleBorder>(GetTransientPackage());
+			Border->SetBrush(Brushes[Index % NumBrushes]);
+			bPassed &= ensureMsgf(Border->GetBrush() == Brushes[Index % NumBrushes], TEXT("An interned border isn't drawing the brush it was given"));
+			Borders.Add(Border);
+		}
+
+		const int32 PooledBrushes = Pool.GetNumUniqueBrushes() - UniqueBefore;
+		const int64 PoolBytes = int64(Pool.GetAllocatedSize()) - int64(PoolBytesBefore);
+
+		// Without the pool every border holds its own live copy of its brush, with it they each hold a reference and an empty Background
+		const int64 CopiedBytes = int64(NumBorders) * sizeof(FSlateBrush);
+		const int64 SharedBytes = PoolBytes + int64(NumBorders) * sizeof(TSharedPtr<const FSlateBrush>);
+		Ar.Logf(TEXT("  %d borders, %d distinct brushes: %d pooled brushes, %lld bytes in the pool"), NumBorders, NumBrushes, PooledBrushes, PoolBytes);
+		Ar.Logf(TEXT("  Brush data: %lld bytes as copies, %lld bytes shared(pool plus a reference per border)"), CopiedBytes, SharedBytes);
+		Ar.Logf(TEXT("  %.0f bytes of brush data saved per 1000 borders"), double(CopiedBytes - SharedBytes) / NumBorders * 1000.0);
+		Ar.Logf(TEXT("  Note: each border still reserves %d bytes for its Background property(it's a UPROPERTY), it's just left empty while interned"), int32(sizeof(FSlateBrush)));
+		bPassed &= ensureMsgf(PooledBrushes == NumBrushes, TEXT("%d borders with %d distinct brushes ended up with %d pooled brushes"), NumBorders, NumBrushes, PooledBrushes);
+
+		// Going away is what releases a border's pooled brush, so once they're all gone so should the brushes be
+		for (UExampleBorder* Border : Borders)
+		{
+			Border->MarkPendingKill();
+			Border->ConditionalBeginDestroy();
+		}
+		const int32 PooledAfter = Pool.GetNumUniqueBrushes() - UniqueBefore;
+		Ar.Logf(TEXT("  %d pooled brushes left once the borders were destroyed"), PooledAfter);
+		bPassed &= ensureMsgf(PooledAfter == 0, TEXT("%d pooled brushes outlived every border using them"), PooledAfter);
+
+		return bPassed;
+	}
+
+	/**
+	 * Prints the average allocations per iteration and complains(with an ensure) if they're over budget, returns whether we're within budget.
+	 * When recording, the budget gets set to what was measured instead(and saved to ConfigFile under CVarName)
+	 */
+	static bool ReportAllocations(const TCHAR* Name, const FExampleAllocationCounts& Counts, int32 Iterations, int32& Budget, const TCHAR* CVarName, bool bRecord, const FString& ConfigFile, FOutputDevice& Ar)
+	{
+		const double AllocationsPerIteration = double(Counts.Allocations) / Iterations;
+		const double BytesPerIteration = double(Counts.Bytes) / Iterations;
+
+		if (bRecord)
+		{
+			Budget = FMath::CeilToInt(AllocationsPerIteration);
+			GConfig->SetInt(TEXT("ConsoleVariables"), CVarName, Budget, ConfigFile);
+			Ar.Logf(TEXT("  %-40s %6.2f allocations %8.1f bytes (recorded %s=%d)"), Name, AllocationsPerIteration, BytesPerIteration, CVarName, Budget);
+			return true;
+		}
+
+		if (Budget < 0)
+		{
+			Ar.Logf(TEXT("  %-40s %6.2f allocations %8.1f bytes (not checked, %s is -1)"), Name, AllocationsPerIteration, BytesPerIteration, CVarName);
+			return true;
+		}
+
+		const bool bWithinBudget = AllocationsPerIteration <= Budget;
+		Ar.Logf(TEXT("  %-40s %6.2f allocations %8.1f bytes (budget %d) %s"), Name, AllocationsPerIteration, BytesPerIteration, Budget, bWithinBudget ? TEXT("OK") : TEXT("OVER BUDGET"));
+		ensureMsgf(bWithinBudget, TEXT("%s made %.2f allocations, its budget is %d"), Name, AllocationsPerIteration, Budget);
+
+		return bWithinBudget;
+	}
+
+	/**
+	 * Checks that a border nobody listens to didn't bind any pointer handlers on its slate widget. This looks at the slate widget
+	 * rather than the border's native accessors, getting one of those binds the handler we're checking for
+	 */
+	static bool CheckNoPointerHandlers(const TSharedRef<SWidget>& Widget, FOutputDevice& Ar)
+	{
+		static const FName PointerEventNames[] = { TEXT("MouseButtonDown"), TEXT("MouseButtonUp"), TEXT("MouseMove"), TEXT("MouseDoubleClick") };
+
+		if (!ensure(Widget->GetType() == TEXT("SExampleBorder")))
+		{
+			return false;
+		}
+
+		const TSharedRef<SExampleBorder> Border = StaticCastSharedRef<SExampleBorder>(Widget);
+		for (const FName& EventName : PointerEventNames)
+		{
+			if (!ensureMsgf(!Border->HasPointerEventHandler(EventName), TEXT("A border without listeners has a %s handler bound"), *EventName.ToString()))
+			{
+				Ar.Logf(TEXT("  A border without listeners has a %s handler bound"), *EventName.ToString());
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Lays a tree of nested borders out at a few different scales in turn(like a widget shown on two monitors with different DPI)
+	 * and reports how many border prepasses there were at each scale, i.e. what a change in DPI costs us. Checks that a scale
+	 * change costs no more than laying out at the same scale again would, one prepass per border.
+	 */
+	static bool RunScalePrepasses(int32 NumBorders, int32 NumRounds, FOutputDevice& Ar)
+	{
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		const int32 Depth = 4;
+		const int32 NumChains = FMath::Max(NumBorders / Depth, 1);
+		const uint32 NumBuilt = uint32(NumChains * Depth);
+		TSharedRef<SVerticalBox> Box = SNew(SVerticalBox);
+		for (int32 Index = 0; Index < NumChains; ++Index)
+		{
+			// Give the innermost border something with a size so every level has a real desired size to compute
+			TSharedRef<SWidget> Content = SNew(SBox).WidthOverride(32.0f + Index % 8).HeightOverride(16.0f);
+			for (int32 Level = 0; Level < Depth; ++Level)
+			{
+				Content = SNew(SExampleBorder).Padding(FMargin(Level + 1.0f))
+				[
+					Content
+				];
+			}
+
+			Box->AddSlot()
+			.AutoHeight()
+			[
+				Content
+			];
+		}
+
+		const float Scales[] = { 1.0f, 1.25f, 2.0f };
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+		bool bPassed = true;
+
+		// Lay out once at the last scale first, so the first measured frame is a scale change too
+		Painter.SetScale(Scales[UE_ARRAY_COUNT(Scales) - 1]);
+		Painter.Paint(Box);
+
+		for (int32 Round = 0; Round < NumRounds; ++Round)
+		{
+			for (float Scale : Scales)
+			{
+				Painter.SetScale(Scale);
+
+				FExampleUIStats::Reset();
+				Painter.Paint(Box);
+				const uint32 Prepasses = FExampleUIStats::BorderPrepasses;
+				Ar.Logf(TEXT("  Round %d, scale %.2f: %u prepasses(%.2f per border), %u paints"), Round, Scale, Prepasses, double(Prepasses) / NumBuilt, FExampleUIStats::BorderPaints);
+				bPassed &= ensureMsgf(Prepasses <= NumBuilt, TEXT("Switching to scale %.2f took %u prepasses for %u borders, more than one each"), Scale, Prepasses, NumBuilt);
+			}
+		}
+
+		// The same frame again at the scale we're already at, which is what a scale change shouldn't cost more than
+		FExampleUIStats::Reset();
+		Painter.Paint(Box);
+		const uint32 SameScalePrepasses = FExampleUIStats::BorderPrepasses;
+		Ar.Logf(TEXT("  Same scale again: %u prepasses"), SameScalePrepasses);
+		bPassed &= ensureMsgf(SameScalePrepasses == NumBuilt, TEXT("Laying out %u borders at the same scale took %u prepasses"), NumBuilt, SameScalePrepasses);
+
+		return bPassed;
+	}
+
+	/**
+	 * Times finding what's under the cursor in a Size x Size border grid at a bunch of random points, with and without the grid's hit index.
+	 * Without it that's slate's hit test grid doing all the work, with it slate only finds the grid and the grid finds the cell
+	 * and walks down into it. Either way the lookup has to come back with the full path down to a border to count as found.
+	 * Returns the average microseconds per lookup.
+	 */
+	static double RunHitTest(int32 Size, bool bUseHitTestIndex, int32 NumPoints, FOutputDevice& Ar)
+	{
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+		TSharedRef<SExampleBorderGrid> Grid = BuildBorderGrid(Size, true, bUseHitTestIndex);
+		Painter.Paint(Grid);
+
+		const FVector2D Resolution(Painter.GetResolution());
+		FRandomStream Random(Size);
+		TArray<FVector2D> Points;
+		Points.Reserve(NumPoints);
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			Points.Add(FVector2D(Random.FRand() * Resolution.X, Random.FRand() * Resolution.Y));
+		}
+
+		int32 NumFound = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (const FVector2D& Point : Points)
+		{
+			const TArray<FWidgetAndPointer> BubblePath = Painter.GetHittestGrid().GetBubblePath(Point, 0.0f, false);
+			NumFound += BubblePath.Num() > 0 && BubblePath.Last().Widget != Grid ? 1 : 0;
+		}
+		const double MicrosecondsPerLookup = (FPlatformTime::Seconds() - StartTime) * 1000000.0 / NumPoints;
+
+		Ar.Logf(TEXT("  %dx%d cells, hit index %s: %.3f us per lookup, %d of %d points found something"),
+			Size, Size, bUseHitTestIndex ? TEXT("on") : TEXT("off"), MicrosecondsPerLookup, NumFound, NumPoints);
+		return MicrosecondsPerLookup;
+	}
+
+	/**
+	 * Loads a screen of NumBorders borders(in chains Depth deep) the UObject way, creating stress widgets and building them,
+	 * then cooks it to a compact border tree and loads that. Reports how long each took and how much they allocated,
+	 * and checks both paint the same number of elements. Returns whether they did.
+	 */
+	static bool RunCompactTreeLoad(UWorld* World, int32 NumBorders, int32 Depth, FOutputDevice& Ar)
+	{
+		const int32 NumChains = FMath::Max(NumBorders / Depth, 1);
+
+		// The UObject way: a UExampleBorder and UExampleBorderSlot for every border, which then build the slate widgets
+		TArray<UExampleStressUserWidget*> Widgets;
+		TSharedRef<SVerticalBox> UObjectScreen = SNew(SVerticalBox);
+		double UObjectMs = 0.0;
+		FExampleAllocationCounts UObjectCounts;
+		{
+			FExampleAllocationScope Scope;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumChains; ++Index)
+			{
+				UExampleStressUserWidget* Widget = CreateWidget<UExampleStressUserWidget>(World, UExampleStressUserWidget::StaticClass());
+				Widget->TreeDepth = Depth;
+				UObjectScreen->AddSlot().AutoHeight()
+				[
+					Widget->TakeWidget()
+				];
+				Widgets.Add(Widget);
+			}
+			UObjectMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			UObjectCounts = Scope.GetCounts();
+		}
+
+		// Cook what we just built
+		TArray<UExampleBorder*> Roots;
+		for (UExampleStressUserWidget* Widget : Widgets)
+		{
+			Roots.Add(Widget->GetBorders()[0]);
+		}
+		const FString Filename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ExampleUI/BenchCompactBorderTree.bin"));
+		if (!FExampleCompactBorderTree::CookToFile(Roots, Filename))
+		{
+			Ar.Logf(TEXT("  Couldn't write %s"), *Filename);
+			return false;
+		}
+
+		// The compact way: map the file and build the slate widgets straight from it
+		TSharedPtr<FExampleCompactBorderTree> Tree;
+		TSharedRef<SVerticalBox> CompactScreen = SNew(SVerticalBox);
+		double CompactMs = 0.0;
+		FExampleAllocationCounts CompactCounts;
+		{
+			FExampleAllocationScope Scope;
+			const double StartTime = FPlatformTime::Seconds();
+			Tree = FExampleCompactBorderTree::LoadFromFile(Filename);
+			if (Tree.IsValid())
+			{
+				for (const TSharedRef<SExampleBorder>& Root : Tree->Instantiate())
+				{
+					CompactScreen->AddSlot().AutoHeight()
+					[
+						Root
+					];
+				}
+			}
+			CompactMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			CompactCounts = Scope.GetCounts();
+		}
+
+		if (!ensureMsgf(Tree.IsValid() && Tree->GetNumBorders() == NumChains * Depth, TEXT("The compact border tree didn't load back the %d borders that were cooked"), NumChains * Depth))
+		{
+			return false;
+		}
+
+		Ar.Logf(TEXT("  UObject path:  %8.2f ms, %8llu allocations, %10llu bytes allocated"), UObjectMs, UObjectCounts.Allocations, UObjectCounts.Bytes);
+		Ar.Logf(TEXT("  Compact path:  %8.2f ms, %8llu allocations, %10llu bytes allocated(plus a %lld byte %s file, %d brushes)"),
+			CompactMs, CompactCounts.Allocations, CompactCounts.Bytes, Tree->GetDataSize(), Tree->IsMapped() ? TEXT("mapped") : TEXT("loaded"), Tree->GetNumBrushes());
+		Ar.Logf(TEXT("  %.2fx faster, %.2fx fewer bytes"), CompactMs > 0.0 ? UObjectMs / CompactMs : 0.0, CompactCounts.Bytes > 0 ? double(UObjectCounts.Bytes) / CompactCounts.Bytes : 0.0);
+
+		// Both screens should look the same, at the very least they should draw as much
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+		Painter.Paint(UObjectScreen);
+		const int32 UObjectElements = Painter.GetElementList().GetUncachedDrawElements().Num();
+		Painter.Paint(CompactScreen);
+		const int32 CompactElements = Painter.GetElementList().GetUncachedDrawElements().Num();
+
+		return ensureMsgf(UObjectElements == CompactElements, TEXT("The UObject screen painted %d elements, the compact one %d"), UObjectElements, CompactElements);
+	}
+
+	/**
+	 * Paints a column of deep border chains(each border the only child of the one above it) for a bunch of unchanged frames,
+	 * with the top border of each chain retaining its content or not. Returns the average paint time in milliseconds.
+	 * When retaining, only the top borders should get painted once the first frames have recorded everything.
+	 */
+	static double RunRetainedBorders(int32 NumChains, int32 Depth, int32 NumFrames, bool bRetainContent, FOutputDevice& Ar)
+	{
+		TSharedRef<SVerticalBox> Box = SNew(SVerticalBox);
+		for (int32 Index = 0; Index < NumChains; ++Index)
+		{
+			TSharedRef<SWidget> Content = SNew(SBox).WidthOverride(64.0f).HeightOverride(4.0f);
+			for (int32 Level = 0; Level < Depth - 1; ++Level)
+			{
+				Content = SNew(SExampleBorder).Padding(FMargin(1.0f))
+				[
+					Content
+				];
+			}
+
+			Box->AddSlot()
+			.AutoHeight()
+			[
+				SNew(SExampleBorder)
+				.RetainContent(bRetainContent)
+				[
+					Content
+				]
+			];
+		}
+
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+
+		// The first couple of frames do the recording
+		Painter.Paint(Box);
+		Painter.Paint(Box);
+
+		double TotalPaintMs = 0.0;
+		FExampleUIStats::Reset();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Painter.Paint(Box);
+			TotalPaintMs += Painter.GetLastPaintMs();
+		}
+		const uint32 Paints = FExampleUIStats::BorderPaints;
+		const double AveragePaintMs = TotalPaintMs / NumFrames;
+
+		Ar.Logf(TEXT("  Retain content %s: %.3f ms per paint, %.1f border paints per frame"),
+			bRetainContent ? TEXT("on") : TEXT("off"), AveragePaintMs, float(Paints) / NumFrames);
+		if (bRetainContent)
+		{
+			ensureMsgf(Paints <= uint32(NumChains * NumFrames), TEXT("Retained border chains painted %u borders over %d frames, expected at most %d"), Paints, NumFrames, NumChains * NumFrames);
+		}
+		return AveragePaintMs;
+	}
+
+	/**
+	 * Paints retained border chains where every border has its color bound, at 144 frames a second with the given refresh rate(0 for none),
+	 * and returns how many borders got painted per frame
+	 */
+	static double RunRefreshRate(int32 NumChains, int32 Depth, int32 NumFrames, float RefreshRate, FOutputDevice& Ar)
+	{
+		static const float FrameTime = 1.0f / 144.0f;
+
+		// Always the same color, its the bindings getting called(and everything getting repainted for them) we're after
+		const TAttribute<FSlateColor> BoundColor = TAttribute<FSlateColor>::Create(TAttribute<FSlateColor>::FGetter::CreateLambda([]()
+		{
+			return FSlateColor(FLinearColor::White);
+		}));
+
+		TSharedRef<SVerticalBox> Box = SNew(SVerticalBox);
+		TArray<TSharedRef<SExampleBorder>> Containers;
+		for (int32 Index = 0; Index < NumChains; ++Index)
+		{
+			TSharedRef<SWidget> Content = SNew(SBox).WidthOverride(64.0f).HeightOverride(4.0f);
+			for (int32 Level = 0; Level < Depth - 1; ++Level)
+			{
+				Content = SNew(SExampleBorder).Padding(FMargin(1.0f)).BorderBackgroundColor(BoundColor)
+				[
+					Content
+				];
+			}
+
+			TSharedRef<SExampleBorder> Container = SNew(SExampleBorder)
+				.RetainContent(true)
+				.RefreshRate(RefreshRate)
+				[
+					Content
+				];
+			Containers.Add(Container);
+
+			Box->AddSlot()
+			.AutoHeight()
+			[
+				Container
+			];
+		}
+
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+
+		// The first couple of frames do the recording
+		Painter.Paint(Box, FrameTime);
+		Painter.Paint(Box, FrameTime);
+
+		FExampleUIStats::Reset();
+		for (const TSharedRef<SExampleBorder>& Container : Containers)
+		{
+			Container->ResetRefreshStats();
+		}
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Painter.Paint(Box, FrameTime);
+		}
+		const double PaintsPerFrame = double(FExampleUIStats::BorderPaints) / NumFrames;
+
+		if (RefreshRate > 0.0f)
+		{
+			Ar.Logf(TEXT("  Refresh rate %.1f Hz: %.1f border paints per frame"), RefreshRate, PaintsPerFrame);
+
+			// Each chain's container paints every frame, the rest of the chain only when it refreshes(plus one in case we started halfway through)
+			const int32 MaxRefreshes = FMath::CeilToInt(NumFrames * FrameTime * RefreshRate) + 1;
+			const int32 MaxPaints = NumChains * NumFrames + NumChains * (Depth - 1) * MaxRefreshes;
+			ensureMsgf(FExampleUIStats::BorderPaints <= uint32(MaxPaints), TEXT("Refresh rate border chains painted %u borders over %d frames, expected at most %d"), FExampleUIStats::BorderPaints, NumFrames, MaxPaints);
+
+			// Every container decides once a frame whether to refresh, and nothing's changed since the first refresh found the
+			// bound borders, so none of the refreshes since should've gone looking again
+			for (int32 Index = 0; Index < Containers.Num(); ++Index)
+			{
+				const SExampleBorder::FRefreshStats Stats = Containers[Index]->GetRefreshStats();
+				if (Index == 0)
+				{
+					Ar.Logf(TEXT("  Each container: %u refreshes, %u skipped, %u lookups of its %d bound borders"), Stats.Refreshes, Stats.SkippedRefreshes, Stats.Lookups, Stats.ThrottledBorders);
+				}
+				ensureMsgf(Stats.Refreshes + Stats.SkippedRefreshes == uint32(NumFrames), TEXT("Refresh rate container %d refreshed %u times and skipped %u over %d frames"), Index, Stats.Refreshes, Stats.SkippedRefreshes, NumFrames);
+				ensureMsgf(Stats.Refreshes <= uint32(MaxRefreshes), TEXT("Refresh rate container %d refreshed %u times over %d frames, expected at most %d"), Index, Stats.Refreshes, NumFrames, MaxRefreshes);
+				ensureMsgf(Stats.Lookups == 0, TEXT("Refresh rate container %d looked up its bound borders %u times with unchanged content"), Index, Stats.Lookups);
+				ensureMsgf(Stats.ThrottledBorders == Depth - 1, TEXT("Refresh rate container %d is throttling %d bound borders, its chain has %d"), Index, Stats.ThrottledBorders, Depth - 1);
+			}
+		}
+		else
+		{
+			Ar.Logf(TEXT("  No refresh rate: %.1f border paints per frame"), PaintsPerFrame);
+		}
+		return PaintsPerFrame;
+	}
+
+	/** Measures the allocations made constructing and synchronizing our borders and checks them against(or records) the budgets above */
+	static bool CheckAllocationBudgets(int32 Iterations, bool bRecord, FOutputDevice& Ar)
+	{
+		// Passing because nothing got counted would be worse than useless
+		if (!FExampleAllocationScope::IsSupported())
+		{
+			Ar.Logf(TEXT("Example border allocation budgets: allocations can't be counted on this platform(it uses a fixed GMalloc class), nothing checked"));
+			return false;
+		}
+
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		TArray<TSharedRef<SWidget>> KeepAlive;
+		KeepAlive.Reserve(Iterations * 2);
+		TArray<UExampleBorder*> Borders;
+		Borders.Reserve(Iterations);
+
+		// Warm up anything that only gets allocated the first time around(static names, the brush pool...etc)
+		{
+			UExampleBorder* Border = NewObject<UExampleBorder>(GetTransientPackage());
+			KeepAlive.Add(Border->TakeWidget());
+			KeepAlive.Add(SNew(SExampleBorder));
+			Borders.Add(Border);
+		}
+
+		FExampleAllocationCounts SlateConstructCounts;
+		{
+			FExampleAllocationScope Scope;
+			for (int32 Index = 0; Index < Iterations; ++Index)
+			{
+				KeepAlive.Add(SNew(SExampleBorder));
+			}
+			SlateConstructCounts = Scope.GetCounts();
+		}
+
+		FExampleAllocationCounts ConstructCounts;
+		{
+			FExampleAllocationScope Scope;
+			for (int32 Index = 0; Index < Iterations; ++Index)
+			{
+				UExampleBorder* Border = NewObject<UExampleBorder>(GetTransientPackage());
+				KeepAlive.Add(Border->TakeWidget());
+				Borders.Add(Border);
+			}
+			ConstructCounts = Scope.GetCounts();
+		}
+
+		FExampleAllocationCounts SyncCounts;
+		{
+			FExampleAllocationScope Scope;
+			for (int32 Index = 0; Index < Iterations; ++Index)
+			{
+				Borders[Index]->SynchronizeProperties();
+			}
+			SyncCounts = Scope.GetCounts();
+		}
+
+		// Recorded budgets go to the project's own config rather than the user's saved one, so they can be checked in
+		const FString DefaultEngineIni = FConfigCacheIni::NormalizeConfigIniPath(FPaths::ProjectConfigDir() / TEXT("DefaultEngine.ini"));
+
+		Ar.Logf(TEXT("Example border allocation budgets, averaged over %d iterations:"), Iterations);
+		bool bWithinBudget = ReportAllocations(TEXT("SNew(SExampleBorder)"), SlateConstructCounts, Iterations,
+			GExampleSlateBorderConstructAllocBudget, TEXT("ExampleUI.Alloc.SlateBorderConstructBudget"), bRecord, DefaultEngineIni, Ar);
+		bWithinBudget &= ReportAllocations(TEXT("UExampleBorder construct + TakeWidget"), ConstructCounts, Iterations,
+			GExampleBorderConstructAllocBudget, TEXT("ExampleUI.Alloc.BorderConstructBudget"), bRecord, DefaultEngineIni, Ar);
+		bWithinBudget &= ReportAllocations(TEXT("UExampleBorder::SynchronizeProperties"), SyncCounts, Iterations,
+			GExampleBorderSyncAllocBudget, TEXT("ExampleUI.Alloc.BorderSyncBudget"), bRecord, DefaultEngineIni, Ar);
+		if (bRecord)
+		{
+			GConfig->Flush(false, DefaultEngineIni);
+			Ar.Logf(TEXT("Budgets written to %s"), *DefaultEngineIni);
+		}
+
+		// None of these borders have anything listening to their input, so none of them should have paid for a pointer handler
+		for (UExampleBorder* Border : Borders)
+		{
+			bWithinBudget &= CheckNoPointerHandlers(Border->TakeWidget(), Ar);
+		}
+
+		for (UExampleBorder* Border : Borders)
+		{
+			Border->ReleaseSlateResources(true);
+		}
+
+		return bWithinBudget;
+	}
+
+	/**
+	 * Paints a grid of borders that get their colors and brush from view models and changes a few of those view models every frame.
+	 * When bPush is false the borders use the old style bindings so every border calls back into its view model every frame,
+	 * when its true the borders use SetViewModel and only hear about the values that changed.
+	 * Returns the average milliseconds per frame spent changing values and painting.
+	 */
+	static double RunViewModelBindings(bool bPush, int32 NumBorders, int32 NumChangedPerFrame, int32 NumFrames, int32 Seed)
+	{
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		TArray<UExampleBorder*> Borders;
+		TArray<UExampleBorderViewModel*> ViewModels;
+		Borders.Reserve(NumBorders);
+		ViewModels.Reserve(NumBorders);
+
+		const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumBorders)));
+		TSharedRef<SUniformGridPanel> Grid = SNew(SUniformGridPanel);
+
+		for (int32 Index = 0; Index < NumBorders; ++Index)
+		{
+			UExampleBorderViewModel* ViewModel = NewObject<UExampleBorderViewModel>(GetTransientPackage());
+			UExampleBorder* Border = NewObject<UExampleBorder>(GetTransientPackage());
+
+			if (bPush)
+			{
+				Border->SetViewModel(ViewModel);
+			}
+			else
+			{
+				// This is what a designer binding to the view model's getters ends up as
+				Border->BrushColorDelegate.BindUFunction(ViewModel, GET_FUNCTION_NAME_CHECKED(UExampleBorderViewModel, GetBrushColor));
+				Border->ContentColorAndOpacityDelegate.BindUFunction(ViewModel, GET_FUNCTION_NAME_CHECKED(UExampleBorderViewModel, GetContentColorAndOpacity));
+				Border->BackgroundDelegate.BindUFunction(ViewModel, GET_FUNCTION_NAME_CHECKED(UExampleBorderViewModel, GetBackground));
+			}
+
+			Grid->AddSlot(Index % Columns, Index / Columns)
+			[
+				Border->TakeWidget()
+			];
+
+			Borders.Add(Border);
+			ViewModels.Add(ViewModel);
+		}
+
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+
+		// One frame to get everything laid out before we start timing
+		Painter.Paint(Grid);
+
+		FRandomStream Stream(Seed);
+		double TotalMs = 0.0;
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const double FrameStart = FPlatformTime::Seconds();
+
+			for (int32 Change = 0; Change < NumChangedPerFrame; ++Change)
+			{
+				UExampleBorderViewModel* ViewModel = ViewModels[Stream.RandHelper(NumBorders)];
+				ViewModel->SetBrushColor(FLinearColor(Stream.FRand(), Stream.FRand(), Stream.FRand()));
+			}
+
+			Painter.Paint(Grid);
+
+			TotalMs += (FPlatformTime::Seconds() - FrameStart) * 1000.0;
+		}
+
+		// Let go of the slate widgets now rather than whenever these borders get garbage collected
+		for (UExampleBorder* Border : Borders)
+		{
+			Border->ReleaseSlateResources(true);
+		}
+
+		return NumFrames > 0 ? TotalMs / NumFrames : 0.0;
+	}
+
+	/** Paints the widget headlessly after a warm up frame(that's where fonts get cached) and returns the average prepass plus paint time */
+	static double TimeHeadlessFrames(FExampleHeadlessPainter& Painter, const TSharedRef<SWidget>& Widget, int32 NumFrames)
+	{
+		Painter.Paint(Widget);
+
+		double TotalMs = 0.0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Painter.Paint(Widget);
+			TotalMs += Painter.GetLastPrepassMs() + Painter.GetLastPaintMs();
+		}
+		return TotalMs / NumFrames;
+	}
+
+	/**
+	 * Paints the nameplate subsystem's draw data for this frame headlessly, once through the nameplate layer and once as an
+	 * SExampleBorder with an STextBlock in it per nameplate on a canvas, and returns how many times faster the layer was
+	 */
+	static double RunNameplates(UExampleNameplateSubsystem* Nameplates, const FVector2D& ViewportSize, int32 NumFrames, FOutputDevice& Ar)
+	{
+		const FVector2D Padding = Nameplates->GetPadding();
+
+		// The same boxes and text the layer draws, in the same places
+		TSharedRef<SCanvas> Canvas = SNew(SCanvas);
+		for (const FExampleNameplateDrawData& Nameplate : Nameplates->GetDrawData())
+		{
+			const FVector2D PlateSize = Nameplate.TextSize + Padding * 2.0f;
+
+			Canvas->AddSlot()
+			.Position(Nameplate.ScreenPosition - FVector2D(PlateSize.X * 0.5f, PlateSize.Y) * Nameplate.Scale)
+			.Size(PlateSize)
+			[
+				SNew(SExampleBorder)
+				.RenderTransform(FSlateRenderTransform(Nameplate.Scale))
+				.BorderImage(Nameplates->GetBrush())
+				.BorderBackgroundColor(Nameplates->GetBrushColor() * Nameplate.Tint)
+				.Padding(FMargin(Padding.X, Padding.Y))
+				[
+					SNew(STextBlock)
+					.Text(Nameplate.Text)
+					.Font(Nameplates->GetFont())
+					.ColorAndOpacity(Nameplates->GetTextColor() * Nameplate.Tint)
+				]
+			];
+		}
+
+		// Screen positions are in viewport pixels, so paint at a scale of 1 over the whole viewport
+		FExampleHeadlessPainter Painter(ViewportSize);
+		FExampleBatchAnalyzer BatchAnalyzer;
+
+		const double LayerMs = TimeHeadlessFrames(Painter, SNew(SExampleNameplateLayer, Nameplates), NumFrames);
+		BatchAnalyzer.Analyze(Painter.GetElementList());
+		Ar.Logf(TEXT("  Nameplate layer: %.3f ms per frame, %d elements in %d batches"), LayerMs, BatchAnalyzer.GetNumElements(), BatchAnalyzer.GetNumBatches());
+
+		// These never move, in game every slot's position would change every frame and relayout on top of this
+		const double WidgetsMs = TimeHeadlessFrames(Painter, Canvas, NumFrames);
+		BatchAnalyzer.Analyze(Painter.GetElementList());
+		Ar.Logf(TEXT("  A border widget each: %.3f ms per frame, %d elements in %d batches(without moving them, so at best)"), WidgetsMs, BatchAnalyzer.GetNumElements(), BatchAnalyzer.GetNumBatches());
+
+		return LayerMs > 0.0 ? WidgetsMs / LayerMs : 0.0;
+	}
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleBrushInterningBenchCommand(
+	TEXT("ExampleUI.Bench.BrushInterning"),
+	TEXT("Gives example borders a handful of brushes through SetBrush and reports the brush bytes interning saves per 1000 borders. Usage: ExampleUI.Bench.BrushInterning [Borders=1000] [Brushes=4]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumBorders = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000, 1);
+		const int32 NumBrushes = FMath::Clamp(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 4, 1, NumBorders);
+
+		Ar.Logf(TEXT("Brush interning:"));
+		const bool bPassed = ExampleUIBenchmarks::RunBrushInterning(NumBorders, NumBrushes, Ar);
+		Ar.Logf(TEXT("Brush interning %s"), bPassed ? TEXT("passed") : TEXT("FAILED"));
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleViewModelBindingsBenchCommand(
+	TEXT("ExampleUI.Bench.ViewModelBindings"),
+	TEXT("Compares polled bindings against pushed view model changes. Usage: ExampleUI.Bench.ViewModelBindings [Borders=5000] [ChangedPercent=1] [Frames=300]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumBorders = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 5000, 1);
+		const float ChangedPercent = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.0f;
+		const int32 NumFrames = FMath::Max(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 300, 1);
+		const int32 NumChanged = FMath::Clamp(FMath::RoundToInt(NumBorders * ChangedPercent / 100.0f), 0, NumBorders);
+
+		// Same seed for both runs so they change exactly the same view models
+		const int32 Seed = 0x5EED;
+		const double PollingMs = ExampleUIBenchmarks::RunViewModelBindings(false, NumBorders, NumChanged, NumFrames, Seed);
+		const double PushMs = ExampleUIBenchmarks::RunViewModelBindings(true, NumBorders, NumChanged, NumFrames, Seed);
+
+		Ar.Logf(TEXT("View model bindings: %d borders, %d changed per frame, %d frames"), NumBorders, NumChanged, NumFrames);
+		Ar.Logf(TEXT("  Polled bindings: %.3f ms/frame, %d binding calls per frame"), PollingMs, NumBorders * 3);
+		Ar.Logf(TEXT("  Pushed changes:  %.3f ms/frame, %d change notifications per frame"), PushMs, NumChanged);
+		Ar.Logf(TEXT("  Note: this paints the whole grid every frame, with global invalidation on the pushed borders that didn't change skip painting too"));
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleAllocationBudgetsCommand(
+	TEXT("ExampleUI.Alloc.CheckBudgets"),
+	TEXT("Counts the heap allocations made constructing and synchronizing example borders and checks them against the ExampleUI.Alloc budgets, or sets the budgets to what it counted with Record. Usage: ExampleUI.Alloc.CheckBudgets [Iterations=100] [Record]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const bool bRecord = Args.ContainsByPredicate([](const FString& Arg) { return Arg.Equals(TEXT("Record"), ESearchCase::IgnoreCase); });
+		const int32 Iterations = FMath::Max(Args.Num() > 0 && Args[0].IsNumeric() ? FCString::Atoi(*Args[0]) : 100, 1);
+		const bool bWithinBudget = ExampleUIBenchmarks::CheckAllocationBudgets(Iterations, bRecord, Ar);
+		Ar.Logf(TEXT("Allocation budgets %s"), bRecord ? TEXT("recorded") : bWithinBudget ? TEXT("passed") : TEXT("FAILED"));
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleScalePrepassesBenchCommand(
+	TEXT("ExampleUI.Bench.ScalePrepasses"),
+	TEXT("Lays out nested example borders at alternating DPI scales and reports the prepasses and paints at each one, checking a scale change costs no more than one prepass per border. Usage: ExampleUI.Bench.ScalePrepasses [Borders=200] [Rounds=3]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumBorders = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200, 1);
+		const int32 NumRounds = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 3, 1);
+
+		Ar.Logf(TEXT("Prepasses per layout scale, %d borders:"), NumBorders);
+		const bool bPassed = ExampleUIBenchmarks::RunScalePrepasses(NumBorders, NumRounds, Ar);
+		Ar.Logf(TEXT("Prepasses per layout scale %s"), bPassed ? TEXT("passed") : TEXT("FAILED"));
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleOverdrawAnalyzeCommand(
+	TEXT("ExampleUI.Overdraw.Analyze"),
+	TEXT("Paints a grid of stress widgets headlessly and writes an overdraw heatmap of it to the saved directory. Usage: ExampleUI.Overdraw.Analyze [Widgets=20] [Depth=4] [FilePattern=Profiling/ExampleUIOverdraw]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (!World)
+		{
+			Ar.Logf(TEXT("ExampleUI.Overdraw.Analyze needs a world to create its widgets in"));
+			return;
+		}
+
+		const int32 NumWidgets = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20, 1);
+		const int32 Depth = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 4, 1);
+		const FString FilePattern = Args.Num() > 2 ? Args[2] : TEXT("Profiling/ExampleUIOverdraw");
+
+		TArray<UUserWidget*> Widgets;
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+		Painter.Paint(ExampleUIBenchmarks::BuildStressGrid(World, NumWidgets, Depth, Widgets));
+
+		FExampleOverdrawAnalyzer Overdraw(Painter.GetResolution());
+		Overdraw.Analyze(Painter.GetElementList());
+		Overdraw.LogStats(Ar);
+		ExampleUIBenchmarks::ReleaseStressWidgets(Widgets);
+
+		FString HeatmapFilename;
+		if (Overdraw.ExportHeatmap(FilePattern, &HeatmapFilename))
+		{
+			Ar.Logf(TEXT("Overdraw heatmap written to %s"), *HeatmapFilename);
+		}
+		else
+		{
+			Ar.Logf(TEXT("Couldn't write the overdraw heatmap"));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleBatchAnalyzeCommand(
+	TEXT("ExampleUI.Batches.Analyze"),
+	TEXT("Paints a grid of stress widgets headlessly and reports how many render batches it makes and why each one was started. Usage: ExampleUI.Batches.Analyze [Widgets=20] [Depth=4] [BreaksToPrint=20]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (!World)
+		{
+			Ar.Logf(TEXT("ExampleUI.Batches.Analyze needs a world to create its widgets in"));
+			return;
+		}
+
+		const int32 NumWidgets = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20, 1);
+		const int32 Depth = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 4, 1);
+		const int32 BreaksToPrint = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 20;
+
+		TArray<UUserWidget*> Widgets;
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+		Painter.Paint(ExampleUIBenchmarks::BuildStressGrid(World, NumWidgets, Depth, Widgets));
+
+		FExampleBatchAnalyzer Batches;
+		Batches.Analyze(Painter.GetElementList());
+		Batches.LogReport(Ar, BreaksToPrint);
+		ExampleUIBenchmarks::ReleaseStressWidgets(Widgets);
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleLayerCompactionCommand(
+	TEXT("ExampleUI.Batches.CompareLayerCompaction"),
+	TEXT("Paints a grid of bordered cells headlessly in a stock SUniformGridPanel and in an SExampleBorderGrid with layer compaction, and compares the render batches. Usage: ExampleUI.Batches.CompareLayerCompaction [Size=100]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 Size = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100, 1);
+
+		FExampleHeadlessPainter::EnsureSlateStyle();
+		FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+
+		// The baseline is the panel you'd use for this without our grid, with exactly the same cells in it
+		Painter.Paint(ExampleUIBenchmarks::BuildUniformBorderGrid(Size));
+		FExampleBatchAnalyzer UniformBatches;
+		UniformBatches.Analyze(Painter.GetElementList());
+		Ar.Logf(TEXT("%dx%d bordered cells, SUniformGridPanel:"), Size, Size);
+		UniformBatches.LogReport(Ar, 0);
+
+		Painter.Paint(ExampleUIBenchmarks::BuildBorderGrid(Size, true));
+		FExampleBatchAnalyzer CompactBatches;
+		CompactBatches.Analyze(Painter.GetElementList());
+		Ar.Logf(TEXT("%dx%d bordered cells, SExampleBorderGrid with layer compaction:"), Size, Size);
+		CompactBatches.LogReport(Ar, 0);
+
+		Ar.Logf(TEXT("Batches: %d with SUniformGridPanel, %d with SExampleBorderGrid"), UniformBatches.GetNumBatches(), CompactBatches.GetNumBatches());
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleHitTestBenchCommand(
+	TEXT("ExampleUI.Bench.HitTest"),
+	TEXT("Times finding the border under the cursor in growing border grids with and without the grid's hit index. Usage: ExampleUI.Bench.HitTest [Points=10000]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumPoints = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000, 1);
+
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		Ar.Logf(TEXT("Pointer move resolution:"));
+		for (const int32 Size : { 16, 32, 64, 128 })
+		{
+			const double WithoutIndex = ExampleUIBenchmarks::RunHitTest(Size, false, NumPoints, Ar);
+			const double WithIndex = ExampleUIBenchmarks::RunHitTest(Size, true, NumPoints, Ar);
+			Ar.Logf(TEXT("  %d borders: %.2fx"), Size * Size * 2, WithIndex > 0.0 ? WithoutIndex / WithIndex : 0.0);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleRetainedBordersBenchCommand(
+	TEXT("ExampleUI.Bench.RetainedBorders"),
+	TEXT("Paints deep static border chains headlessly with and without retained content and compares paint times. Usage: ExampleUI.Bench.RetainedBorders [Chains=20] [Depth=50] [Frames=60]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumChains = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20, 1);
+		const int32 Depth = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 50, 1);
+		const int32 NumFrames = FMath::Max(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 60, 1);
+
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		// Retaining is an invalidation panel under the hood, if those can't cache there's nothing to compare
+		if (!SNew(SInvalidationPanel)->GetCanCache())
+		{
+			Ar.Logf(TEXT("Retained borders: invalidation panels can't cache(is Slate.EnableInvalidationPanels off or global invalidation on?), nothing to compare"));
+			return;
+		}
+
+		Ar.Logf(TEXT("Retained borders, %d chains %d deep:"), NumChains, Depth);
+		const double WithoutRetain = ExampleUIBenchmarks::RunRetainedBorders(NumChains, Depth, NumFrames, false, Ar);
+		const double WithRetain = ExampleUIBenchmarks::RunRetainedBorders(NumChains, Depth, NumFrames, true, Ar);
+		Ar.Logf(TEXT("  %.2fx"), WithRetain > 0.0 ? WithoutRetain / WithRetain : 0.0);
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleHibernationBenchCommand(
+	TEXT("ExampleUI.Bench.Hibernation"),
+	TEXT("Reopens a stress widget over and over, rebuilding it every time and then restoring it from hibernation, and compares the reopen times. Usage: ExampleUI.Bench.Hibernation [Depth=8] [Rounds=20]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UExampleWidgetHibernationSubsystem* Hibernation = UExampleWidgetHibernationSubsystem::Get(World);
+		if (!Hibernation)
+		{
+			Ar.Logf(TEXT("ExampleUI.Bench.Hibernation needs a game world to create its widgets in"));
+			return;
+		}
+
+		const int32 Depth = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 8, 1);
+		const int32 NumRounds = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 20, 1);
+
+		// Without hibernation every reopen is a brand new widget getting built from scratch
+		double ColdMs = 0.0;
+		for (int32 Round = 0; Round < NumRounds; ++Round)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			UExampleStressUserWidget* Widget = CreateWidget<UExampleStressUserWidget>(World, UExampleStressUserWidget::StaticClass());
+			Widget->TreeDepth = Depth;
+			const TSharedRef<SWidget> SlateWidget = Widget->TakeWidget();
+			ColdMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		}
+
+		// With it the same widget gets restored and hands back the tree it already has
+		UExampleStressUserWidget* Widget = CreateWidget<UExampleStressUserWidget>(World, UExampleStressUserWidget::StaticClass());
+		Widget->TreeDepth = Depth;
+		Widget->TakeWidget();
+		Hibernation->Hibernate(Widget);
+
+		double WarmMs = 0.0;
+		for (int32 Round = 0; Round < NumRounds; ++Round)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Hibernation->Restore(Widget);
+			const TSharedRef<SWidget> SlateWidget = Widget->TakeWidget();
+			WarmMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			Hibernation->Hibernate(Widget);
+		}
+
+		// Don't leave our test widget taking up hibernation budget
+		Hibernation->Restore(Widget);
+
+		Ar.Logf(TEXT("Reopening a stress widget %d borders deep, %d rounds:"), Depth, NumRounds);
+		Ar.Logf(TEXT("  Rebuilt: %.3f ms per open"), ColdMs / NumRounds);
+		Ar.Logf(TEXT("  Restored from hibernation: %.3f ms per open"), WarmMs / NumRounds);
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleCompactTreeBenchCommand(
+	TEXT("ExampleUI.Bench.CompactTree"),
+	TEXT("Loads a screen of borders through UObjects and from a cooked compact border tree and compares load times and allocations. Usage: ExampleUI.Bench.CompactTree [Borders=10000] [Depth=40]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (!World)
+		{
+			Ar.Logf(TEXT("ExampleUI.Bench.CompactTree needs a world to create its widgets in"));
+			return;
+		}
+
+		const int32 NumBorders = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000, 1);
+		const int32 Depth = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 40, 1);
+
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		Ar.Logf(TEXT("Compact border tree, %d borders %d deep:"), NumBorders, Depth);
+		const bool bMatched = ExampleUIBenchmarks::RunCompactTreeLoad(World, NumBorders, Depth, Ar);
+		Ar.Logf(TEXT("  %s"), bMatched ? TEXT("Both screens paint the same") : TEXT("SCREENS DIFFER"));
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleWidgetTimersBenchCommand(
+	TEXT("ExampleUI.Bench.WidgetTimers"),
+	TEXT("Sets a timer per widget like a screen full of widgets being constructed would, on the world timer manager and on the widget timers, and compares. Usage: ExampleUI.Bench.WidgetTimers [Widgets=5000]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UExampleWidgetTimerSubsystem* Timers = World ? World->GetSubsystem<UExampleWidgetTimerSubsystem>() : nullptr;
+		if (!Timers)
+		{
+			Ar.Logf(TEXT("ExampleUI.Bench.WidgetTimers needs a world to set its timers in"));
+			return;
+		}
+
+		const int32 NumWidgets = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 5000, 1);
+
+		// Widgets spawned over a few frames all want to do something a few seconds later, so the deadlines are close but not identical
+		FRandomStream Random(NumWidgets);
+		TArray<float> Delays;
+		for (int32 Index = 0; Index < NumWidgets; ++Index)
+		{
+			Delays.Add(3.0f + Random.FRand() * 0.1f);
+		}
+
+		TArray<FTimerHandle> TimerHandles;
+		TimerHandles.SetNum(NumWidgets);
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumWidgets; ++Index)
+		{
+			World->GetTimerManager().SetTimer(TimerHandles[Index], FTimerDelegate::CreateLambda([]() {}), Delays[Index], false);
+		}
+		const double TimerManagerSetMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (FTimerHandle& Handle : TimerHandles)
+		{
+			World->GetTimerManager().ClearTimer(Handle);
+		}
+		const double TimerManagerClearMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		TArray<FExampleWidgetTimerHandle> WidgetHandles;
+		WidgetHandles.SetNum(NumWidgets);
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumWidgets; ++Index)
+		{
+			WidgetHandles[Index] = Timers->SetTimer(World, Delays[Index], []() {});
+		}
+		const double WidgetTimersSetMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (FExampleWidgetTimerHandle& Handle : WidgetHandles)
+		{
+			Timers->ClearTimer(Handle);
+		}
+		const double WidgetTimersClearMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		Ar.Logf(TEXT("%d widget timers:"), NumWidgets);
+		Ar.Logf(TEXT("  Timer manager: %.3f ms to set, %.3f ms to clear"), TimerManagerSetMs, TimerManagerClearMs);
+		Ar.Logf(TEXT("  Widget timers: %.3f ms to set, %.3f ms to clear"), WidgetTimersSetMs, WidgetTimersClearMs);
+		Timers->DumpStats(Ar);
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleNameplatesBenchCommand(
+	TEXT("ExampleUI.Bench.Nameplates"),
+	TEXT("Puts nameplates on a grid of actors in front of the camera and compares painting them through the nameplate layer against an SExampleBorder each. Usage: ExampleUI.Bench.Nameplates [Count=500] [Frames=60]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UExampleNameplateSubsystem* Nameplates = World ? World->GetSubsystem<UExampleNameplateSubsystem>() : nullptr;
+		APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+		if (!Nameplates || !PlayerController || !World->GetGameViewport())
+		{
+			Ar.Logf(TEXT("ExampleUI.Bench.Nameplates needs a game world with a player to project the nameplates for"));
+			return;
+		}
+
+		const int32 Count = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 500, 1);
+		const int32 NumFrames = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 60, 1);
+		const int32 Columns = FMath::CeilToInt(FMath::Sqrt(float(Count)));
+		const int32 Rows = (Count + Columns - 1) / Columns;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		const FRotationMatrix ViewMatrix(ViewRotation);
+
+		// Spread over most of the view a little way out, so every one of them is on screen and close enough to get drawn
+		const float Distance = 1500.0f;
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		// Nameplates only need something with a location, a bare actor is plenty
+		TArray<AActor*> Actors;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const float X = Columns > 1 ? float(Index % Columns) / (Columns - 1) - 0.5f : 0.0f;
+			const float Y = Rows > 1 ? float(Index / Columns) / (Rows - 1) - 0.5f : 0.0f;
+			const FVector Location = ViewLocation + ViewMatrix.GetUnitAxis(EAxis::X) * Distance
+				+ ViewMatrix.GetUnitAxis(EAxis::Y) * X * Distance * 1.6f + ViewMatrix.GetUnitAxis(EAxis::Z) * Y * Distance * 0.8f;
+
+			AActor* Actor = World->SpawnActor<AActor>(Location, FRotator::ZeroRotator, SpawnParameters);
+			if (!Actor)
+			{
+				continue;
+			}
+
+			USceneComponent* Root = NewObject<USceneComponent>(Actor);
+			Actor->SetRootComponent(Root);
+			Root->RegisterComponent();
+			Actor->SetActorLocation(Location);
+
+			Nameplates->SetNameplate(Actor, FText::FromString(FString::Printf(TEXT("Nameplate %d"), Index)));
+			Actors.Add(Actor);
+		}
+
+		// Projects them like any other frame would
+		Nameplates->Tick(0.0f);
+
+		FVector2D ViewportSize;
+		World->GetGameViewport()->GetViewportSize(ViewportSize);
+
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		Ar.Logf(TEXT("Nameplates, %d on screen at %dx%d, %.3f ms to project them:"), Nameplates->GetDrawData().Num(),
+			int32(ViewportSize.X), int32(ViewportSize.Y), Nameplates->GetLastUpdateMs());
+		const double Speedup = ExampleUIBenchmarks::RunNameplates(Nameplates, ViewportSize, NumFrames, Ar);
+		Ar.Logf(TEXT("  %.2fx"), Speedup);
+
+		for (AActor* Actor : Actors)
+		{
+			Nameplates->RemoveNameplate(Actor);
+			Actor->Destroy();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleRefreshRateBenchCommand(
+	TEXT("ExampleUI.Bench.RefreshRate"),
+	TEXT("Paints retained border chains with bound colors headlessly at 144Hz, with and without a refresh rate, and compares how many borders get painted. Usage: ExampleUI.Bench.RefreshRate [Chains=20] [Depth=20] [Frames=144] [Rate=10]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumChains = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20, 1);
+		const int32 Depth = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 20, 2);
+		const int32 NumFrames = FMath::Max(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 144, 1);
+		const float RefreshRate = FMath::Max(Args.Num() > 3 ? FCString::Atof(*Args[3]) : 10.0f, 0.1f);
+
+		FExampleHeadlessPainter::EnsureSlateStyle();
+
+		// Same as the retained borders, without caching nothing gets reused between refreshes
+		if (!SNew(SInvalidationPanel)->GetCanCache())
+		{
+			Ar.Logf(TEXT("Refresh rate: invalidation panels can't cache(is Slate.EnableInvalidationPanels off or global invalidation on?), nothing to compare"));
+			return;
+		}
+
+		Ar.Logf(TEXT("Refresh rate, %d bound chains %d deep at 144Hz:"), NumChains, Depth);
+		const double EveryFrame = ExampleUIBenchmarks::RunRefreshRate(NumChains, Depth, NumFrames, 0.0f, Ar);
+		const double Throttled = ExampleUIBenchmarks::RunRefreshRate(NumChains, Depth, NumFrames, RefreshRate, Ar);
+		Ar.Logf(TEXT("  %.2fx fewer border paints"), Throttled > 0.0 ? EveryFrame / Throttled : 0.0);
+	}));
@@ -0,0 +1,33 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleUIStats.h"
+
+DEFINE_STAT(STAT_ExampleBorderPaints);
+DEFINE_STAT(STAT_ExampleBorderPrepasses);
+DEFINE_STAT(STAT_ExampleDeferredBorderSyncs);
+DEFINE_STAT(STAT_ExampleNameplatesDrawn);
+DEFINE_STAT(STAT_ExampleBorderRefreshes);
+DEFINE_STAT(STAT_ExampleBorderSkippedRefreshes);
+DEFINE_STAT(STAT_ExampleThrottledBorderRebuilds);
+DEFINE_STAT(STAT_ExampleBorderWidgetsBuilt);
+DEFINE_STAT(STAT_ExampleBorderWidgetsReused);
+
+uint32 FExampleUIStats::BorderPaints = 0;
+uint32 FExampleUIStats::BorderPrepasses = 0;
+uint32 FExampleUIStats::BorderRefreshes = 0;
+uint32 FExampleUIStats::BorderSkippedRefreshes = 0;
+uint32 FExampleUIStats::ThrottledBorderRebuilds = 0;
+uint32 FExampleUIStats::BorderWidgetsBuilt = 0;
+uint32 FExampleUIStats::BorderWidgetsReused = 0;
+
+void FExampleUIStats::Reset()
+{
+	BorderPaints = 0;
+	BorderPrepasses = 0;
+	BorderRefreshes = 0;
+	BorderSkippedRefreshes = 0;
+	ThrottledBorderRebuilds = 0;
+	BorderWidgetsBuilt = 0;
+	BorderWidgetsReused = 0;
+}
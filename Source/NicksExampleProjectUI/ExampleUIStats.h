@@ -0,0 +1,93 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Shows up with "stat ExampleUI"
+DECLARE_STATS_GROUP(TEXT("ExampleUI"), STATGROUP_ExampleUI, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Border Paints"), STAT_ExampleBorderPaints, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Border Prepasses"), STAT_ExampleBorderPrepasses, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Border Syncs"), STAT_ExampleDeferredBorderSyncs, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Nameplates Drawn"), STAT_ExampleNameplatesDrawn, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Border Refreshes"), STAT_ExampleBorderRefreshes, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Border Skipped Refreshes"), STAT_ExampleBorderSkippedRefreshes, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Throttled Border Rebuilds"), STAT_ExampleThrottledBorderRebuilds, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Border Widgets Built"), STAT_ExampleBorderWidgetsBuilt, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Border Widgets Reused"), STAT_ExampleBorderWidgetsReused, STATGROUP_ExampleUI, NICKSEXAMPLEPROJECTUI_API);
+
+/**
+ * Running counters of the work our example widgets do. The stats above reset every frame and aren't
+ * available in every build configuration, these are plain numbers that tools(like the stress test) can read and reset themselves.
+ * Game thread only.
+ */
+struct NICKSEXAMPLEPROJECTUI_API FExampleUIStats
+{
+	/** How many times an SExampleBorder has been painted */
+	static uint32 BorderPaints;
+
+	/** How many times an SExampleBorder has computed its desired size */
+	static uint32 BorderPrepasses;
+
+	/** How many times a border with a refresh rate has had its bound borders pick up their bindings again, summed over all of them(SExampleBorder::GetRefreshStats has each one's) */
+	static uint32 BorderRefreshes;
+
+	/** How many frames a border with a refresh rate has let go by without refreshing */
+	static uint32 BorderSkippedRefreshes;
+
+	/** How many times a border with a refresh rate has had to go looking for the bound borders in its content again */
+	static uint32 ThrottledBorderRebuilds;
+
+	/** How many times a UExampleBorder has built itself a new slate widget */
+	static uint32 BorderWidgetsBuilt;
+
+	/** How many times a UExampleBorder in a designer preview took back the slate widget it had in the last preview instead */
+	static uint32 BorderWidgetsReused;
+
+	static void CountBorderPaint()
+	{
+		++BorderPaints;
+		INC_DWORD_STAT(STAT_ExampleBorderPaints);
+	}
+
+	static void CountBorderPrepass()
+	{
+		++BorderPrepasses;
+		INC_DWORD_STAT(STAT_ExampleBorderPrepasses);
+	}
+
+	static void CountBorderRefresh()
+	{
+		++BorderRefreshes;
+		INC_DWORD_STAT(STAT_ExampleBorderRefreshes);
+	}
+
+	static void CountBorderSkippedRefresh()
+	{
+		++BorderSkippedRefreshes;
+		INC_DWORD_STAT(STAT_ExampleBorderSkippedRefreshes);
+	}
+
+	static void CountThrottledBorderRebuild()
+	{
+		++ThrottledBorderRebuilds;
+		INC_DWORD_STAT(STAT_ExampleThrottledBorderRebuilds);
+	}
+
+	static void CountBorderWidgetBuilt()
+	{
+		++BorderWidgetsBuilt;
+		INC_DWORD_STAT(STAT_ExampleBorderWidgetsBuilt);
+	}
+
+	static void CountBorderWidgetReused()
+	{
+		++BorderWidgetsReused;
+		INC_DWORD_STAT(STAT_ExampleBorderWidgetsReused);
+	}
+
+	/** Sets all the counters back to zero */
+	static void Reset();
+};
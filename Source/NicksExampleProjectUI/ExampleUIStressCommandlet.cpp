@@ -0,0 +1,113 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleUIStressCommandlet.h"
+#include "ExampleBatchAnalyzer.h"
+#include "ExampleHeadlessPainter.h"
+#include "ExampleOverdrawAnalyzer.h"
+#include "ExampleStressUserWidget.h"
+#include "ExampleUIStats.h"
+#include "ExampleUIStressRunner.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Rendering/DrawElements.h"
+#include "TimerManager.h"
+#include "Widgets/Layout/SUniformGridPanel.h"
+
+UExampleUIStressCommandlet::UExampleUIStressCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UExampleUIStressCommandlet::Main(const FString& Params)
+{
+	FExampleUIStressSettings Settings;
+	Settings.ParseOverrides(*Params);
+
+	// Our widgets need a world to live in(the user widget sets a timer on construct for example)
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FExampleUIStressRunner Runner(Settings);
+
+	// Lay all of the widgets out in a square-ish grid so everything gets a bit of space
+	const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Settings.WidgetCount)));
+	TSharedRef<SUniformGridPanel> Grid = SNew(SUniformGridPanel);
+
+	for (int32 Index = 0; Index < Settings.WidgetCount; ++Index)
+	{
+		UExampleStressUserWidget* Widget = CreateWidget<UExampleStressUserWidget>(World, UExampleStressUserWidget::StaticClass());
+		Widget->TreeDepth = Settings.TreeDepth;
+
+		Grid->AddSlot(Index % Columns, Index / Columns)
+		[
+			Widget->TakeWidget()
+		];
+
+		Runner.AddBorders(Widget->GetBorders());
+		Widgets.Add(Widget);
+	}
+
+	FExampleHeadlessPainter Painter(FVector2D(1920.0f, 1080.0f));
+	const float DeltaTime = 1.0f / 60.0f;
+
+	FExampleUIStats::Reset();
+	while (!Runner.IsFinished())
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+
+		// Nothing else is advancing the frame counter for us, and the timer manager only ticks once per frame
+		++GFrameCounter;
+		Runner.ChurnProperties();
+		World->GetTimerManager().Tick(DeltaTime);
+		Painter.Paint(Grid, DeltaTime);
+
+		const double FrameMs = (FPlatformTime::Seconds() - FrameStart) * 1000.0;
+		Runner.RecordFrame(FrameMs, Painter.GetLastPrepassMs(), Painter.GetLastPaintMs(), Painter.GetElementList().GetUncachedDrawElements().Num());
+	}
+
+	bool bWritten = Runner.WriteCsv();
+
+	// The last frame is as good as any for seeing where we draw over ourselves
+	if (FParse::Param(*Params, TEXT("StressOverdraw")))
+	{
+		FExampleOverdrawAnalyzer Overdraw(Painter.GetResolution());
+		Overdraw.Analyze(Painter.GetElementList());
+		Overdraw.LogStats(*GLog);
+
+		FString HeatmapFilename;
+		const FString HeatmapPattern = FPaths::Combine(FPaths::GetPath(Settings.OutputPath), TEXT("ExampleUIOverdraw"));
+		if (Overdraw.ExportHeatmap(HeatmapPattern, &HeatmapFilename))
+		{
+			UE_LOG(LogTemp, Display, TEXT("Overdraw heatmap written to %s"), *HeatmapFilename);
+		}
+		else
+		{
+			// Failing to write it fails the whole run, same as the CSV
+			UE_LOG(LogTemp, Error, TEXT("Couldn't write the overdraw heatmap to %s"), *HeatmapPattern);
+			bWritten = false;
+		}
+	}
+
+	if (FParse::Param(*Params, TEXT("StressBatches")))
+	{
+		FExampleBatchAnalyzer Batches;
+		Batches.Analyze(Painter.GetElementList());
+		Batches.LogReport(*GLog);
+	}
+
+	// Clean up after ourselves
+	for (UExampleStressUserWidget* Widget : Widgets)
+	{
+		Widget->ReleaseSlateResources(true);
+	}
+	Widgets.Empty();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return bWritten ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ExampleUIStressCommandlet.generated.h"
+
+class UExampleStressUserWidget;
+
+/**
+ * Headless UI soak/perf test for build machines without a GPU.
+ * Spawns example widgets into a transient world and paints them ourselves each frame with scripted property changes,
+ * then writes frame time percentiles and widget stats to a CSV.
+ *
+ * With -StressOverdraw the last frame also gets an overdraw heatmap(see FExampleOverdrawAnalyzer) written next to the CSV,
+ * and with -StressBatches a render batch report(see FExampleBatchAnalyzer) in the log.
+ *
+ * Usage: UE4Editor-Cmd NicksExampleProject -run=ExampleUIStress -nullrhi [-StressWidgets=N] [-StressDepth=N] [-StressFrames=N] [-StressChurn=F] [-StressOutput=Path] [-StressOverdraw] [-StressBatches]
+ */
+UCLASS()
+class UExampleUIStressCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UExampleUIStressCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+
+	/** Keeps our widgets from being garbage collected */
+	UPROPERTY(Transient)
+	TArray<UExampleStressUserWidget*> Widgets;
+};
@@ -0,0 +1,126 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleUIStressRunner.h"
+#include "ExampleBorder.h"
+#include "ExampleUIStats.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+void FExampleUIStressSettings::ParseOverrides(const TCHAR* Params)
+{
+	FParse::Value(Params, TEXT("StressWidgets="), WidgetCount);
+	FParse::Value(Params, TEXT("StressDepth="), TreeDepth);
+	FParse::Value(Params, TEXT("StressFrames="), FrameCount);
+	FParse::Value(Params, TEXT("StressChurn="), ChurnFraction);
+	FParse::Value(Params, TEXT("StressSeed="), Seed);
+	FParse::Value(Params, TEXT("StressOutput="), OutputPath);
+
+	WidgetCount = FMath::Max(WidgetCount, 1);
+	TreeDepth = FMath::Max(TreeDepth, 1);
+	FrameCount = FMath::Max(FrameCount, 1);
+	ChurnFraction = FMath::Clamp(ChurnFraction, 0.0f, 1.0f);
+}
+
+FExampleUIStressRunner::FExampleUIStressRunner(const FExampleUIStressSettings& InSettings)
+	: Settings(InSettings)
+	, Random(InSettings.Seed)
+{
+	Frames.Reserve(Settings.FrameCount);
+}
+
+void FExampleUIStressRunner::AddBorders(const TArray<UExampleBorder*>& InBorders)
+{
+	for (UExampleBorder* Border : InBorders)
+	{
+		Borders.Add(Border);
+	}
+}
+
+void FExampleUIStressRunner::ChurnProperties()
+{
+	if (Borders.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 NumToChange = FMath::RoundToInt(Borders.Num() * Settings.ChurnFraction);
+	for (int32 Index = 0; Index < NumToChange; ++Index)
+	{
+		if (UExampleBorder* Border = Borders[Random.RandHelper(Borders.Num())].Get())
+		{
+			// Color changes only need a repaint, padding changes need a new layout too, so we do a bit of both
+			Border->SetBrushColor(FLinearColor(Random.GetFraction(), Random.GetFraction(), Random.GetFraction()));
+			if (Random.GetFraction() < 0.25f)
+			{
+				Border->SetPadding(FMargin(Random.RandRange(0, 8), Random.RandRange(0, 4)));
+			}
+			++ChangedSinceLastFrame;
+		}
+	}
+}
+
+void FExampleUIStressRunner::RecordFrame(double FrameMs, double PrepassMs, double PaintMs, int32 NumDrawElements)
+{
+	FFrameResult& Frame = Frames.AddDefaulted_GetRef();
+	Frame.FrameMs = FrameMs;
+	Frame.PrepassMs = PrepassMs;
+	Frame.PaintMs = PaintMs;
+	Frame.NumDrawElements = NumDrawElements;
+	Frame.BorderPaints = FExampleUIStats::BorderPaints;
+	Frame.BorderPrepasses = FExampleUIStats::BorderPrepasses;
+	Frame.ChangedBorders = ChangedSinceLastFrame;
+
+	FExampleUIStats::Reset();
+	ChangedSinceLastFrame = 0;
+}
+
+bool FExampleUIStressRunner::WriteCsv() const
+{
+	FString Csv;
+	Csv += FString::Printf(TEXT("# Widgets=%d Depth=%d Borders=%d Frames=%d Churn=%.3f Seed=%d\n"),
+		Settings.WidgetCount, Settings.TreeDepth, Borders.Num(), Frames.Num(), Settings.ChurnFraction, Settings.Seed);
+
+	// Per frame results
+	Csv += TEXT("Frame,FrameMs,PrepassMs,PaintMs,DrawElements,BorderPaints,BorderPrepasses,ChangedBorders\n");
+	for (int32 Index = 0; Index < Frames.Num(); ++Index)
+	{
+		const FFrameResult& Frame = Frames[Index];
+		Csv += FString::Printf(TEXT("%d,%.4f,%.4f,%.4f,%d,%u,%u,%d\n"),
+			Index, Frame.FrameMs, Frame.PrepassMs, Frame.PaintMs, Frame.NumDrawElements, Frame.BorderPaints, Frame.BorderPrepasses, Frame.ChangedBorders);
+	}
+
+	// Percentile summary for each of the timings
+	auto AppendPercentiles = [this, &Csv](const TCHAR* Name, double FFrameResult::* Member)
+	{
+		TArray<double> Sorted;
+		Sorted.Reserve(Frames.Num());
+		for (const FFrameResult& Frame : Frames)
+		{
+			Sorted.Add(Frame.*Member);
+		}
+		Sorted.Sort();
+
+		auto Percentile = [&Sorted](double Fraction)
+		{
+			return Sorted.Num() > 0 ? Sorted[FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1)] : 0.0;
+		};
+
+		Csv += FString::Printf(TEXT("%s,%.4f,%.4f,%.4f,%.4f,%.4f\n"), Name, Percentile(0.5), Percentile(0.9), Percentile(0.95), Percentile(0.99), Percentile(1.0));
+	};
+
+	Csv += TEXT("\nStat,P50,P90,P95,P99,Max\n");
+	AppendPercentiles(TEXT("FrameMs"), &FFrameResult::FrameMs);
+	AppendPercentiles(TEXT("PrepassMs"), &FFrameResult::PrepassMs);
+	AppendPercentiles(TEXT("PaintMs"), &FFrameResult::PaintMs);
+
+	const FString FullPath = FPaths::IsRelative(Settings.OutputPath) ? FPaths::Combine(FPaths::ProjectSavedDir(), Settings.OutputPath) : Settings.OutputPath;
+	if (!FFileHelper::SaveStringToFile(Csv, *FullPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UI stress: failed to write results to %s"), *FullPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UI stress: wrote %d frames of results to %s"), Frames.Num(), *FullPath);
+	return true;
+}
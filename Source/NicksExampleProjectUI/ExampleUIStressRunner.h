@@ -0,0 +1,85 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UExampleBorder;
+
+/** The knobs for a UI stress run, these can all be overridden from the command line(e.g. -StressWidgets=500) */
+struct NICKSEXAMPLEPROJECTUI_API FExampleUIStressSettings
+{
+	/** How many user widgets get spawned */
+	int32 WidgetCount = 100;
+
+	/** How many borders each user widget has nested inside of it */
+	int32 TreeDepth = 4;
+
+	/** How many frames we measure before writing the results */
+	int32 FrameCount = 600;
+
+	/** The fraction(0-1) of all borders that get a property changed every frame */
+	float ChurnFraction = 0.1f;
+
+	/** Seed for the property churn so runs are repeatable */
+	int32 Seed = 1337;
+
+	/** Where the CSV goes, relative paths are relative to the project's saved directory */
+	FString OutputPath = TEXT("Profiling/ExampleUIStress.csv");
+
+	/** Reads any overrides from the given command line/parameter string */
+	void ParseOverrides(const TCHAR* Params);
+};
+
+/**
+ * The shared part of our UI stress tests, used by both the stress game mode and the commandlet.
+ * It changes properties on a set of borders every frame and records per frame timings and widget stats which get written to a CSV.
+ */
+class NICKSEXAMPLEPROJECTUI_API FExampleUIStressRunner
+{
+public:
+
+	explicit FExampleUIStressRunner(const FExampleUIStressSettings& InSettings);
+
+	/** Adds borders whose properties will get changed every frame */
+	void AddBorders(const TArray<UExampleBorder*>& InBorders);
+
+	/** Changes the brush color and padding of a random selection of borders */
+	void ChurnProperties();
+
+	/**
+	 * Records one frame's worth of results, the border counters in FExampleUIStats are read and reset here.
+	 * Prepass/Paint times are only known when we're the ones painting(the commandlet), otherwise pass in 0.
+	 */
+	void RecordFrame(double FrameMs, double PrepassMs = 0.0, double PaintMs = 0.0, int32 NumDrawElements = 0);
+
+	/** Whether or not we've recorded all the frames we were asked to */
+	bool IsFinished() const { return Frames.Num() >= Settings.FrameCount; }
+
+	/** Writes the per frame results followed by a percentile summary, returns false if the file couldn't be written */
+	bool WriteCsv() const;
+
+	const FExampleUIStressSettings& GetSettings() const { return Settings; }
+
+private:
+
+	struct FFrameResult
+	{
+		double FrameMs;
+		double PrepassMs;
+		double PaintMs;
+		int32 NumDrawElements;
+		uint32 BorderPaints;
+		uint32 BorderPrepasses;
+		int32 ChangedBorders;
+	};
+
+	FExampleUIStressSettings Settings;
+	FRandomStream Random;
+
+	TArray<TWeakObjectPtr<UExampleBorder>> Borders;
+	TArray<FFrameResult> Frames;
+
+	/** How many borders we changed since the last recorded frame */
+	int32 ChangedSinceLastFrame = 0;
+};
@@ -0,0 +1,69 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ExampleUserWidget.h"
+#include "ExampleBorder.h"
+
+UExampleUserWidget::UExampleUserWidget(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	
+}
+
+void UExampleUserWidget::ChangeBorderColor(FLinearColor InColor)
+{
+	// Even if you know it should be connected to something valid, its good to be safe about it
+	if(Border)
+	{
+		// Set the border's brush color itself
+		Border->SetBrushColor(InColor);
+	}
+}
+
+FExampleWidgetTimerHandle UExampleUserWidget::SetWidgetTimer(float Delay, TFunction<void()>&& Callback)
+{
+	UWorld* World = GetWorld();
+	UExampleWidgetTimerSubsystem* Timers = World ? World->GetSubsystem<UExampleWidgetTimerSubsystem>() : nullptr;
+	if (!Timers)
+	{
+		return FExampleWidgetTimerHandle();
+	}
+
+	// Forget about the ones that already fired so this doesn't keep growing on widgets that set lots of timers
+	WidgetTimers.RemoveAllSwap([Timers](const FExampleWidgetTimerHandle& Handle) { return !Timers->IsTimerActive(Handle); });
+
+	const FExampleWidgetTimerHandle Handle = Timers->SetTimer(this, Delay, MoveTemp(Callback));
+	WidgetTimers.Add(Handle);
+	return Handle;
+}
+
+void UExampleUserWidget::ClearWidgetTimers()
+{
+	UWorld* World = GetWorld();
+	if (UExampleWidgetTimerSubsystem* Timers = World ? World->GetSubsystem<UExampleWidgetTimerSubsystem>() : nullptr)
+	{
+		for (FExampleWidgetTimerHandle& Handle : WidgetTimers)
+		{
+			Timers->ClearTimer(Handle);
+		}
+	}
+	WidgetTimers.Reset();
+}
+
+void UExampleUserWidget::NativeConstruct()
+{
+	// Turn our border red after 3 seconds, this timer belongs to us so it gets cancelled if we're destructed before then.
+	// Every widget constructed around the same time shares the one dispatch rather than each getting its own timer
+	SetWidgetTimer(3.0f, [this]()
+	{
+		ChangeBorderColor(FLinearColor::Red);
+	});
+
+	// We finished what we needed to happen, now we notify BP that construct has occured
+	Super::NativeConstruct();
+}
+
+void UExampleUserWidget::NativeDestruct()
+{
+	ClearWidgetTimers();
+
+	Super::NativeDestruct();
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "ExampleWidgetTimers.h"
 #include "ExampleUserWidget.generated.h"
 
 class UExampleBorder;
@@ -15,7 +16,7 @@ class UExampleBorder;
  * 
  */
 UCLASS(abstract)
-class NICKSEXAMPLEPROJECT_API UExampleUserWidget : public UUserWidget
+class NICKSEXAMPLEPROJECTUI_API UExampleUserWidget : public UUserWidget
 {
 	GENERATED_BODY()
 	
@@ -34,11 +35,28 @@ public:
 	 */
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget))
 	UExampleBorder* Border;
+
+	/**
+	 * Calls Callback after Delay seconds, batched with every other widget's timers due around the same time(see UExampleWidgetTimerSubsystem).
+	 * The timer belongs to this widget, so it never fires after we've been destructed.
+	 */
+	FExampleWidgetTimerHandle SetWidgetTimer(float Delay, TFunction<void()>&& Callback);
+
+	/** Stops every timer this widget set that hasn't fired yet */
+	void ClearWidgetTimers();
 	
 protected:
 
 	/** Overriding our native construction function */
 	virtual void NativeConstruct() override;
+
+	/** Here we clear our timers, once we're off the screen nothing they'd do would be seen */
+	virtual void NativeDestruct() override;
+
+private:
+
+	/** The timers we've set, some of these may have fired already */
+	TArray<FExampleWidgetTimerHandle> WidgetTimers;
 	
 };
 
@@ -0,0 +1,210 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleWidgetHibernation.h"
+#include "ExampleBorder.h"
+#include "ExampleSyncScheduler.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GExampleHibernationMaxSlateWidgets = 5000;
+static FAutoConsoleVariableRef CVarExampleHibernationMaxSlateWidgets(
+	TEXT("ExampleUI.Hibernation.MaxSlateWidgets"),
+	GExampleHibernationMaxSlateWidgets,
+	TEXT("How many slate widgets hibernated user widgets can add up to before the least recently used ones get destroyed."));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleHibernationStatsCommand(
+	TEXT("ExampleUI.Hibernation.Stats"),
+	TEXT("Prints what's hibernating and how restores have gone."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (UExampleWidgetHibernationSubsystem* Hibernation = UExampleWidgetHibernationSubsystem::Get(World))
+		{
+			Hibernation->DumpStats(Ar);
+		}
+	}));
+
+/** Counts the slate widgets in a tree, a rough stand in for how much memory it's holding onto */
+static int32 CountSlateWidgets(const TSharedRef<SWidget>& Widget)
+{
+	int32 Count = 1;
+	FChildren* Children = Widget->GetChildren();
+	for (int32 ChildIndex = 0; ChildIndex < Children->Num(); ++ChildIndex)
+	{
+		Count += CountSlateWidgets(Children->GetChildAt(ChildIndex));
+	}
+	return Count;
+}
+
+void UExampleWidgetHibernationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UExampleWidgetHibernationSubsystem::HandleWorldCleanup);
+}
+
+void UExampleWidgetHibernationSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	FTicker::GetCoreTicker().RemoveTicker(ReleaseRestoredHandle);
+	RestoredSlateWidgets.Empty();
+	EvictAll();
+
+	Super::Deinitialize();
+}
+
+void UExampleWidgetHibernationSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UExampleWidgetHibernationSubsystem* This = CastChecked<UExampleWidgetHibernationSubsystem>(InThis);
+	for (FHibernatedWidget& Entry : This->Hibernated)
+	{
+		Collector.AddReferencedObject(Entry.Widget, This);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+UExampleWidgetHibernationSubsystem* UExampleWidgetHibernationSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UExampleWidgetHibernationSubsystem>() : nullptr;
+}
+
+bool UExampleWidgetHibernationSubsystem::Hibernate(UUserWidget* Widget)
+{
+	if (!Widget)
+	{
+		return false;
+	}
+
+	// Grab the slate widget before we take it off the screen, once nothing holds onto it it'd be destroyed
+	const TSharedPtr<SWidget> SlateWidget = Widget->GetCachedWidget();
+	Widget->RemoveFromParent();
+
+	if (!SlateWidget.IsValid() || IsHibernating(Widget))
+	{
+		return SlateWidget.IsValid();
+	}
+
+	FHibernatedWidget& Entry = Hibernated.AddDefaulted_GetRef();
+	Entry.Widget = Widget;
+	Entry.SlateWidget = SlateWidget;
+	Entry.NumSlateWidgets = CountSlateWidgets(SlateWidget.ToSharedRef());
+	TotalSlateWidgets += Entry.NumSlateWidgets;
+
+	EvictOverBudget();
+	return IsHibernating(Widget);
+}
+
+bool UExampleWidgetHibernationSubsystem::Restore(UUserWidget* Widget)
+{
+	const int32 Index = Hibernated.IndexOfByPredicate([Widget](const FHibernatedWidget& Entry) { return Entry.Widget == Widget; });
+	if (Index == INDEX_NONE)
+	{
+		++NumColdRestores;
+		return false;
+	}
+
+	// Hold onto the slate widget until whoever restored us has taken it, otherwise it'd be destroyed right here
+	RestoredSlateWidgets.Add(Hibernated[Index].SlateWidget);
+	if (!ReleaseRestoredHandle.IsValid())
+	{
+		ReleaseRestoredHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UExampleWidgetHibernationSubsystem::ReleaseRestored));
+	}
+
+	TotalSlateWidgets -= Hibernated[Index].NumSlateWidgets;
+	Hibernated.RemoveAt(Index, 1, false);
+	++NumWarmRestores;
+
+	// Our borders kept their slate widgets the whole time, so every setter still reached them.
+	// All that can be behind is a deferred sync that hasn't happened yet, which can't wait now we're about to be seen
+	if (Widget->WidgetTree)
+	{
+		Widget->WidgetTree->ForEachWidget([](UWidget* Child)
+		{
+			if (UExampleBorder* Border = Cast<UExampleBorder>(Child))
+			{
+				FExampleSyncScheduler::Get().FlushBorder(Border);
+			}
+		});
+	}
+
+	return true;
+}
+
+bool UExampleWidgetHibernationSubsystem::RestoreToViewport(UUserWidget* Widget, int32 ZOrder)
+{
+	if (!Widget)
+	{
+		return false;
+	}
+
+	// Adding it to the viewport takes the slate widget it already has(as long as it still has one), no rebuild needed
+	const bool bWasHibernating = Restore(Widget);
+	Widget->AddToViewport(ZOrder);
+	return bWasHibernating;
+}
+
+bool UExampleWidgetHibernationSubsystem::IsHibernating(const UUserWidget* Widget) const
+{
+	return Hibernated.ContainsByPredicate([Widget](const FHibernatedWidget& Entry) { return Entry.Widget == Widget; });
+}
+
+void UExampleWidgetHibernationSubsystem::EvictAll()
+{
+	while (Hibernated.Num() > 0)
+	{
+		Evict(Hibernated.Num() - 1);
+	}
+}
+
+void UExampleWidgetHibernationSubsystem::DumpStats(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Widget hibernation: %d widgets hibernating holding %d slate widgets(budget %d)"), Hibernated.Num(), TotalSlateWidgets, GExampleHibernationMaxSlateWidgets);
+	Ar.Logf(TEXT("  %u warm restores, %u cold restores, %u evictions"), NumWarmRestores, NumColdRestores, NumEvictions);
+	for (const FHibernatedWidget& Entry : Hibernated)
+	{
+		Ar.Logf(TEXT("  %s: %d slate widgets"), *GetNameSafe(Entry.Widget), Entry.NumSlateWidgets);
+	}
+}
+
+void UExampleWidgetHibernationSubsystem::EvictOverBudget()
+{
+	// The oldest are at the front, but always keep the one we just hibernated even if it's over budget by itself
+	while (Hibernated.Num() > 1 && TotalSlateWidgets > GExampleHibernationMaxSlateWidgets)
+	{
+		Evict(0);
+	}
+}
+
+void UExampleWidgetHibernationSubsystem::Evict(int32 Index)
+{
+	// Letting go of the slate widget destroys the tree like closing the widget normally would have(NativeDestruct and all)
+	TotalSlateWidgets -= Hibernated[Index].NumSlateWidgets;
+	Hibernated.RemoveAt(Index);
+	++NumEvictions;
+}
+
+bool UExampleWidgetHibernationSubsystem::ReleaseRestored(float DeltaTime)
+{
+	RestoredSlateWidgets.Reset();
+	ReleaseRestoredHandle.Reset();
+	return false;
+}
+
+void UExampleWidgetHibernationSubsystem::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	for (int32 Index = Hibernated.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Hibernated[Index].Widget || Hibernated[Index].Widget->GetWorld() == World)
+		{
+			Evict(Index);
+		}
+	}
+}
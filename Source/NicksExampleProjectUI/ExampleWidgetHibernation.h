@@ -0,0 +1,114 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ExampleWidgetHibernation.generated.h"
+
+class UUserWidget;
+
+/**
+ * Keeps the slate widgets of closed user widgets around so opening them again doesn't rebuild them.
+ *
+ * Normally once a user widget gets removed from the screen nothing holds onto its slate widget anymore, so the whole tree gets
+ * destroyed(NativeDestruct, ReleaseSlateResources on every widget) and opening it again goes through RebuildWidget, BuildSlot,
+ * SynchronizeProperties and NativeConstruct for every widget in it all over again.
+ * Hibernating a widget takes it off the screen but keeps its slate widget alive, so when it gets restored UMG just hands
+ * back the tree it already built with all of its state intact.
+ *
+ * While a widget's hibernating its borders keep their slate widgets, so setters still reach them and nothing goes stale.
+ * The only thing a restore has to catch up on is borders still waiting on the FExampleSyncScheduler, which get synchronized straight away.
+ *
+ * Hibernated widgets are kept in least recently used order, once they add up to more slate widgets than
+ * "ExampleUI.Hibernation.MaxSlateWidgets" the oldest get let go of(and destroyed like they would've been normally).
+ */
+UCLASS()
+class NICKSEXAMPLEPROJECTUI_API UExampleWidgetHibernationSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//~ Begin USubsystem Interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	/** Keeps our hibernated widgets from being garbage collected */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	/** Shortcut to get the subsystem from anything in a world, can be null */
+	static UExampleWidgetHibernationSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Takes the widget off the screen(or out of whatever it was in) and keeps its slate widget alive for later.
+	 * Returns false if it was never built, in which case there's nothing to keep and it's just removed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Widget Hibernation")
+	bool Hibernate(UUserWidget* Widget);
+
+	/**
+	 * Takes the widget out of hibernation and catches it up on anything it missed, after this add it to the screen as usual
+	 * and it'll reuse the tree it already had. Returns false if it wasn't hibernating(it'll get built like normal then).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Widget Hibernation")
+	bool Restore(UUserWidget* Widget);
+
+	/** Restores the widget and adds it to the viewport, returns whether it was hibernating */
+	UFUNCTION(BlueprintCallable, Category = "Widget Hibernation")
+	bool RestoreToViewport(UUserWidget* Widget, int32 ZOrder = 0);
+
+	UFUNCTION(BlueprintPure, Category = "Widget Hibernation")
+	bool IsHibernating(const UUserWidget* Widget) const;
+
+	/** Lets go of every hibernated widget */
+	UFUNCTION(BlueprintCallable, Category = "Widget Hibernation")
+	void EvictAll();
+
+	/** Prints what's hibernating and how restores have gone */
+	void DumpStats(FOutputDevice& Ar) const;
+
+private:
+
+	struct FHibernatedWidget
+	{
+		UUserWidget* Widget;
+
+		/** What keeps the slate tree alive */
+		TSharedPtr<SWidget> SlateWidget;
+
+		/** How many slate widgets are in the tree, this is what we budget on */
+		int32 NumSlateWidgets;
+	};
+
+	/** Lets go of the least recently used widgets until we're back under budget */
+	void EvictOverBudget();
+
+	/** Lets go of one widget */
+	void Evict(int32 Index);
+
+	/** Lets go of the slate widgets we held onto for widgets restored last frame, they're someone else's problem by now */
+	bool ReleaseRestored(float DeltaTime);
+
+	/** Widgets belonging to a world that's going away can't be restored anyway */
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	/** Least recently hibernated first */
+	TArray<FHibernatedWidget> Hibernated;
+	int32 TotalSlateWidgets = 0;
+
+	/**
+	 * The slate widgets of widgets we've just restored. User widgets only keep a weak pointer to their slate widget,
+	 * so we hang onto it until the next frame to give whoever restored it the chance to put it back on the screen.
+	 */
+	TArray<TSharedPtr<SWidget>> RestoredSlateWidgets;
+	FDelegateHandle ReleaseRestoredHandle;
+
+	FDelegateHandle WorldCleanupHandle;
+
+	// Some numbers for DumpStats
+	uint32 NumWarmRestores = 0;
+	uint32 NumColdRestores = 0;
+	uint32 NumEvictions = 0;
+};
@@ -0,0 +1,142 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ExampleWidgetTimers.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static float GExampleWidgetTimerQuantum = 0.05f;
+static FAutoConsoleVariableRef CVarExampleWidgetTimerQuantum(
+	TEXT("ExampleUI.Timers.Quantum"),
+	GExampleWidgetTimerQuantum,
+	TEXT("Widget timer deadlines get rounded up to a multiple of this many seconds so timers due around the same time fire together."));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleWidgetTimerStatsCommand(
+	TEXT("ExampleUI.Timers.Stats"),
+	TEXT("Prints how many widget timers are waiting and how well they've been batched."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (UExampleWidgetTimerSubsystem* Timers = World ? World->GetSubsystem<UExampleWidgetTimerSubsystem>() : nullptr)
+		{
+			Timers->DumpStats(Ar);
+		}
+	}));
+
+void UExampleWidgetTimerSubsystem::Deinitialize()
+{
+	// Nothing's going to be around to fire them
+	Buckets.Empty();
+	BucketHeap.Empty();
+	NumActiveTimers = 0;
+
+	Super::Deinitialize();
+}
+
+ETickableTickType UExampleWidgetTimerSubsystem::GetTickableTickType() const
+{
+	// Our class default object gets constructed too, that one should never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UExampleWidgetTimerSubsystem::IsTickable() const
+{
+	return BucketHeap.Num() > 0;
+}
+
+TStatId UExampleWidgetTimerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UExampleWidgetTimerSubsystem, STATGROUP_Tickables);
+}
+
+void UExampleWidgetTimerSubsystem::Tick(float DeltaTime)
+{
+	const int64 DueBucket = GetDueBucket(GetTime());
+	while (BucketHeap.Num() > 0 && BucketHeap.HeapTop() <= DueBucket)
+	{
+		int64 Bucket = 0;
+		BucketHeap.HeapPop(Bucket, false);
+
+		// Take the bucket out first, a callback setting or clearing timers mustn't change what we're looping over
+		TArray<FTimer> Timers;
+		Buckets.RemoveAndCopyValue(Bucket, Timers);
+		NumActiveTimers -= Timers.Num();
+		++NumDispatches;
+
+		for (FTimer& Timer : Timers)
+		{
+			if (Timer.Owner.IsValid())
+			{
+				++NumTimersFired;
+				Timer.Callback();
+			}
+		}
+	}
+}
+
+FExampleWidgetTimerHandle UExampleWidgetTimerSubsystem::SetTimer(const UObject* Owner, float Delay, TFunction<void()>&& Callback)
+{
+	FExampleWidgetTimerHandle Handle;
+	Handle.Id = NextTimerId++;
+
+	// Never a bucket that's already due, so a timer set from a callback can't fire in the same dispatch
+	Handle.Bucket = FMath::Max(GetDeadlineBucket(GetTime() + FMath::Max(Delay, 0.0f)), GetDueBucket(GetTime()) + 1);
+
+	TArray<FTimer>* Bucket = Buckets.Find(Handle.Bucket);
+	if (!Bucket)
+	{
+		// Only a deadline nobody else has touches the heap
+		Bucket = &Buckets.Add(Handle.Bucket);
+		BucketHeap.HeapPush(Handle.Bucket);
+	}
+	Bucket->Add({ Handle.Id, Owner, MoveTemp(Callback) });
+
+	++NumActiveTimers;
+	++NumTimersSet;
+	return Handle;
+}
+
+void UExampleWidgetTimerSubsystem::ClearTimer(FExampleWidgetTimerHandle& Handle)
+{
+	if (TArray<FTimer>* Bucket = Buckets.Find(Handle.Bucket))
+	{
+		const int32 Index = Bucket->IndexOfByPredicate([&Handle](const FTimer& Timer) { return Timer.Id == Handle.Id; });
+		if (Index != INDEX_NONE)
+		{
+			// Keep the order, the rest of the bucket still fires in the order it was set.
+			// An emptied bucket stays in the heap and just fires nothing, that's cheaper than digging it back out
+			Bucket->RemoveAt(Index, 1, false);
+			--NumActiveTimers;
+			++NumTimersCleared;
+		}
+	}
+	Handle.Invalidate();
+}
+
+bool UExampleWidgetTimerSubsystem::IsTimerActive(const FExampleWidgetTimerHandle& Handle) const
+{
+	const TArray<FTimer>* Bucket = Handle.IsValid() ? Buckets.Find(Handle.Bucket) : nullptr;
+	return Bucket && Bucket->ContainsByPredicate([&Handle](const FTimer& Timer) { return Timer.Id == Handle.Id; });
+}
+
+void UExampleWidgetTimerSubsystem::DumpStats(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Widget timers: %d waiting in %d buckets(%.3fs quantum)"), NumActiveTimers, Buckets.Num(), GExampleWidgetTimerQuantum);
+	Ar.Logf(TEXT("  %llu set, %llu fired, %llu cleared, %llu dispatches(%.2f timers per dispatch)"),
+		NumTimersSet, NumTimersFired, NumTimersCleared, NumDispatches, NumDispatches > 0 ? double(NumTimersFired) / NumDispatches : 0.0);
+}
+
+int64 UExampleWidgetTimerSubsystem::GetDeadlineBucket(double Time)
+{
+	return int64(FMath::CeilToDouble(Time / FMath::Max(GExampleWidgetTimerQuantum, 0.001f)));
+}
+
+int64 UExampleWidgetTimerSubsystem::GetDueBucket(double Time)
+{
+	return int64(FMath::FloorToDouble(Time / FMath::Max(GExampleWidgetTimerQuantum, 0.001f)));
+}
+
+double UExampleWidgetTimerSubsystem::GetTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
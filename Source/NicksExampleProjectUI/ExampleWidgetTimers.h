@@ -0,0 +1,99 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "ExampleWidgetTimers.generated.h"
+
+/** Identifies a timer set on the UExampleWidgetTimerSubsystem, an unset handle has an Id of 0 */
+struct FExampleWidgetTimerHandle
+{
+	uint64 Id = 0;
+
+	/** The deadline bucket the timer's in, so clearing it only has to look through the one bucket */
+	int64 Bucket = 0;
+
+	bool IsValid() const { return Id != 0; }
+	void Invalidate() { Id = 0; }
+};
+
+/**
+ * Cheap one shot timers for widgets.
+ *
+ * Setting a timer on the world's timer manager is a heap insertion per timer, so a screen spawning hundreds of widgets that
+ * each set a timer floods it. Here deadlines get rounded up to the next "ExampleUI.Timers.Quantum" seconds, and every timer
+ * due at the same rounded deadline goes in the same bucket. Setting a timer is just adding it to its bucket(the heap only
+ * grows when it's a new deadline), and when the deadline comes around the whole bucket fires in one go, in the order they were set.
+ * Timers can fire up to a quantum late, don't use these for anything that needs to be exact.
+ *
+ * Every timer has an owner and never fires once its owner is gone, UExampleUserWidget also clears its timers when it's destructed.
+ * Timers follow the world's time, so they don't count down while the game's paused.
+ */
+UCLASS()
+class NICKSEXAMPLEPROJECTUI_API UExampleWidgetTimerSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	//~ Begin USubsystem Interface
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	//~ End FTickableGameObject Interface
+
+	/** Calls Callback once Delay seconds have passed(rounded up to the next quantum), as long as Owner is still around by then */
+	FExampleWidgetTimerHandle SetTimer(const UObject* Owner, float Delay, TFunction<void()>&& Callback);
+
+	/** Stops the timer from firing and invalidates the handle, does nothing if it already fired */
+	void ClearTimer(FExampleWidgetTimerHandle& Handle);
+
+	/** Whether or not the timer is still waiting to fire */
+	bool IsTimerActive(const FExampleWidgetTimerHandle& Handle) const;
+
+	int32 GetNumActiveTimers() const { return NumActiveTimers; }
+
+	/** Prints how many timers there are and how well they've been batched */
+	void DumpStats(FOutputDevice& Ar) const;
+
+private:
+
+	struct FTimer
+	{
+		uint64 Id;
+		TWeakObjectPtr<const UObject> Owner;
+		TFunction<void()> Callback;
+	};
+
+	/** Which bucket a deadline goes in, every deadline in (Bucket - 1, Bucket] quanta belongs to it */
+	static int64 GetDeadlineBucket(double Time);
+
+	/** The last bucket that's due at the given time, a bucket is due once its whole quantum has passed */
+	static int64 GetDueBucket(double Time);
+
+	/** The current world time */
+	double GetTime() const;
+
+	/** Timers waiting to fire, by deadline bucket */
+	TMap<int64, TArray<FTimer>> Buckets;
+
+	/** The buckets in Buckets as a min heap, so finding the next one due is quick */
+	TArray<int64> BucketHeap;
+
+	uint64 NextTimerId = 1;
+	int32 NumActiveTimers = 0;
+
+	// Some numbers for DumpStats
+	uint64 NumTimersSet = 0;
+	uint64 NumTimersFired = 0;
+	uint64 NumTimersCleared = 0;
+	uint64 NumDispatches = 0;
+};
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NicksExampleProjectStressGameMode.h"
+#include "ExampleStressUserWidget.h"
+#include "ExampleUIStats.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+
+ANicksExampleProjectStressGameMode::ANicksExampleProjectStressGameMode()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	WidgetClass = UExampleStressUserWidget::StaticClass();
+}
+
+void ANicksExampleProjectStressGameMode::BeginPlay()
+{
+	Super::BeginPlay();
+
+	FExampleUIStressSettings Settings;
+	Settings.WidgetCount = WidgetCount;
+	Settings.TreeDepth = TreeDepth;
+	Settings.FrameCount = FrameCount;
+	Settings.ChurnFraction = ChurnFraction;
+	Settings.ParseOverrides(FCommandLine::Get());
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("ExitAfterStress")))
+	{
+		bExitWhenFinished = true;
+	}
+
+	Runner = MakeUnique<FExampleUIStressRunner>(Settings);
+
+	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(this, 0);
+	for (int32 Index = 0; Index < Settings.WidgetCount; ++Index)
+	{
+		UExampleStressUserWidget* Widget = CreateWidget<UExampleStressUserWidget>(PlayerController, WidgetClass);
+		if (!Widget)
+		{
+			continue;
+		}
+
+		// The tree gets built when the widget is added to the viewport so the depth has to be set before that
+		Widget->TreeDepth = Settings.TreeDepth;
+		Widget->AddToViewport();
+
+		Runner->AddBorders(Widget->GetBorders());
+		Widgets.Add(Widget);
+	}
+
+	// Don't count whatever happened before we started
+	FExampleUIStats::Reset();
+}
+
+void ANicksExampleProjectStressGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!Runner.IsValid() || Runner->IsFinished())
+	{
+		return;
+	}
+
+	// We tick before slate paints, so the counters we read here are from the previous frame along with the delta time
+	Runner->RecordFrame(FApp::GetDeltaTime() * 1000.0);
+	Runner->ChurnProperties();
+
+	if (Runner->IsFinished())
+	{
+		Runner->WriteCsv();
+
+		if (bExitWhenFinished)
+		{
+			FPlatformMisc::RequestExit(false);
+		}
+	}
+}
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NicksExampleProjectGameMode.h"
+#include "ExampleUIStressRunner.h"
+#include "NicksExampleProjectStressGameMode.generated.h"
+
+class UExampleStressUserWidget;
+
+/**
+ * A game mode that fills the viewport with example widgets, changes their properties every frame and writes frame timings to a CSV.
+ * Run it headless on a build machine with something like:
+ *   NicksExampleProject -game -nullrhi ?game=/Script/NicksExampleProjectUI.NicksExampleProjectStressGameMode -StressWidgets=500 -ExitAfterStress
+ */
+UCLASS(config=Game)
+class ANicksExampleProjectStressGameMode : public ANicksExampleProjectGameMode
+{
+	GENERATED_BODY()
+
+public:
+	ANicksExampleProjectStressGameMode();
+
+	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** The widget class that gets spawned, has to be a stress widget(or subclass) since it builds its own border tree */
+	UPROPERTY(EditDefaultsOnly, Category = "Stress")
+	TSubclassOf<UExampleStressUserWidget> WidgetClass;
+
+	/** How many widgets get spawned, -StressWidgets= overrides this */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Stress")
+	int32 WidgetCount = 100;
+
+	/** How many borders deep each widget is, -StressDepth= overrides this */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Stress")
+	int32 TreeDepth = 4;
+
+	/** How many frames get measured, -StressFrames= overrides this */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Stress")
+	int32 FrameCount = 600;
+
+	/** Fraction of the borders that get changed every frame, -StressChurn= overrides this */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Stress")
+	float ChurnFraction = 0.1f;
+
+	/** Whether or not to quit once the results are written, -ExitAfterStress also turns this on */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Stress")
+	bool bExitWhenFinished = false;
+
+private:
+
+	/** Keeps our widgets from being garbage collected */
+	UPROPERTY(Transient)
+	TArray<UExampleStressUserWidget*> Widgets;
+
+	TUniquePtr<FExampleUIStressRunner> Runner;
+};
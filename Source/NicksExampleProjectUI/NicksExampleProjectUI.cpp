@@ -0,0 +1,7 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NicksExampleProjectUI.h"
+#include "Modules/ModuleManager.h"
+
+// All of the example UI(borders, user widgets, nameplates and the tools around them), client only so dedicated servers never load it
+IMPLEMENT_MODULE( FDefaultModuleImpl, NicksExampleProjectUI );
@@ -0,0 +1,633 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SExampleBorder.h"
+
+#include "SlateOptMacros.h"
+#include "HAL/IConsoleManager.h"
+#include "Types/ReflectionMetadata.h"
+#include "Widgets/SInvalidationPanel.h"
+#include "ExampleInputLatency.h"
+#include "ExampleUIStats.h"
+
+// This is a newer macro that is meant to help build the project faster
+// so you won't see this in most regular widgets because they haven't been updated in a long time.
+// What this macro specifically does, is it indicates to the compiler that we do not want it to attempt to optimize this code block
+// apparently this macro should be placed on large slate widget declarations as the heavy nesting can cause the compiler to spend a lot of time
+// attempting to optimize the single expression
+BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
+
+static FName SExampleBorderTypeName("SExampleBorder");
+
+/**
+ * Every border that currently has a refresh rate, for "ExampleUI.RefreshRate.Stats". Weak so a border that went away without
+ * taking itself out(it can't from its destructor, its weak pointers are already gone by then) just gets skipped. Game thread only
+ */
+static TArray<TWeakPtr<SExampleBorder>> GExampleRefreshRateBorders;
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ExampleRefreshRateStatsCommand(
+	TEXT("ExampleUI.RefreshRate.Stats"),
+	TEXT("Prints how often each border with a refresh rate has refreshed its content, how many refreshes it skipped and how often it had to look up its bound borders again. Add Reset to start counting from zero."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		SExampleBorder::DumpRefreshRateStats(Ar, Args.Contains(TEXT("Reset")));
+	}));
+
+void SExampleBorder::Construct(const FArguments& InArgs)
+{
+	// Only do this if we're exactly an SExampleBorder
+	if (GetType() == SExampleBorderTypeName)
+	{
+		SetCanTick(false);
+		bCanSupportFocus = false;
+	}
+
+	// Set our variables to what our inputted arguments are
+	ContentScale = InArgs._ContentScale;
+	ColorAndOpacity = InArgs._ColorAndOpacity;
+	DesiredSizeScale = InArgs._DesiredSizeScale;
+
+	ShowDisabledEffect = InArgs._ShowEffectWhenDisabled;
+
+	AssignBorderImage(InArgs._BorderImage);
+	BorderBackgroundColor = InArgs._BorderBackgroundColor;
+	ForegroundColor = InArgs._ForegroundColor;
+
+	// Set our delegates but only if the inputted arguments has a bound delegate
+	if (InArgs._OnMouseButtonDown.IsBound())
+	{
+		SetOnMouseButtonDown(InArgs._OnMouseButtonDown);
+	}
+	if (InArgs._OnMouseButtonUp.IsBound())
+	{
+		SetOnMouseButtonUp(InArgs._OnMouseButtonUp);
+	}
+	if (InArgs._OnMouseMove.IsBound())
+	{
+		SetOnMouseMove(InArgs._OnMouseMove);
+	}
+	if (InArgs._OnMouseDoubleClick.IsBound())
+	{
+		SetOnMouseDoubleClick(InArgs._OnMouseDoubleClick);
+	}
+	
+	ChildSlot // Here we are getting the variable ChildSlot
+    .HAlign(InArgs._HAlign) // and then setting its HAlign variable to our inputted argument
+    .VAlign(InArgs._VAlign) // and then setting its VAlign variable to our inputted argument
+    .Padding(InArgs._Padding) // and then setting its padding variable to our inputted argument
+    [ // These brackets are to signal a child widget is being modified, like your getting a value out of an array by doing MyArray[i]
+    	InArgs._Content.Widget // Here's where we're setting that slot's widget to our inputted argument's content widget
+    ]; // And we're done
+
+	if (InArgs._RetainContent)
+	{
+		SetRetainContent(true);
+	}
+	if (InArgs._RefreshRate > 0.0f)
+	{
+		SetRefreshRate(InArgs._RefreshRate);
+	}
+}
+
+SExampleBorder::~SExampleBorder()
+{
+	if (Refresh.IsValid())
+	{
+		// Anything still around after us isn't ours to throttle anymore. No invalidating here though,
+		// whatever's left of our content is most likely on its way out along with us
+		for (const TWeakPtr<SExampleBorder>& Border : Refresh->ThrottledBorders)
+		{
+			if (const TSharedPtr<SExampleBorder> PinnedBorder = Border.Pin())
+			{
+				PinnedBorder->bRefreshThrottled = false;
+			}
+		}
+	}
+}
+
+void SExampleBorder::SetContent(TSharedRef<SWidget> InContent)
+{
+	// Setting the same content again(which our UMG slot does every time it syncs) shouldn't cost anything
+	if (GetContent() == InContent)
+	{
+		return;
+	}
+
+	// Whoever's throttling the bound borders in here has to look them up again
+	MarkThrottledBordersDirty();
+
+	// While we're retaining, the content goes in our panel which throws out what it recorded by itself
+	if (RetainerPanel.IsValid())
+	{
+		RetainedContent = InContent;
+		RetainerPanel->SetContent(InContent);
+		return;
+	}
+
+	ChildSlot // Get the ChildSlot variable
+	[ // Brackets to notify we're doing stuff to the widget that's tied to this slot
+		InContent // Set that widget to be InContent
+	];
+
+	// Our children changed, which with global invalidation means our part of the widget list has to be rebuilt
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+const TSharedRef<SWidget>& SExampleBorder::GetContent() const
+{
+	// We just get the ChildSlot variable and get the widget from that slot(unless its our retainer panel, then we kept it aside)
+	return RetainerPanel.IsValid() ? RetainedContent : ChildSlot.GetWidget();
+}
+
+void SExampleBorder::ClearContent()
+{
+	MarkThrottledBordersDirty();
+
+	if (RetainerPanel.IsValid())
+	{
+		RetainedContent = SNullWidget::NullWidget;
+		RetainerPanel->SetContent(SNullWidget::NullWidget);
+		return;
+	}
+
+	// What this does is it returns the widget that was detached, and also sets its widget to a SNullWidget
+	ChildSlot.DetachWidget(); // I'VE ABANDONED MY CHILD!!!!
+
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+void SExampleBorder::SetRetainContent(bool bInRetainContent)
+{
+	bWantsRetainContent = bInRetainContent;
+	SetRetainerPanelEnabled(bWantsRetainContent || Refresh.IsValid());
+}
+
+void SExampleBorder::SetRetainerPanelEnabled(bool bEnabled)
+{
+	if (bEnabled == IsRetainingContent())
+	{
+		return;
+	}
+
+	// Grab our content before we start moving it around
+	const TSharedRef<SWidget> Content = GetContent();
+	if (bEnabled)
+	{
+		RetainedContent = Content;
+		RetainerPanel = SNew(SInvalidationPanel)
+		[
+			Content
+		];
+		ChildSlot
+		[
+			RetainerPanel.ToSharedRef()
+		];
+	}
+	else
+	{
+		ChildSlot
+		[
+			Content
+		];
+		RetainerPanel.Reset();
+		RetainedContent = SNullWidget::NullWidget;
+	}
+
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+void SExampleBorder::SetRefreshRate(float InRefreshRate)
+{
+	InRefreshRate = FMath::Max(InRefreshRate, 0.0f);
+	if (InRefreshRate == GetRefreshRate())
+	{
+		return;
+	}
+
+	if (InRefreshRate > 0.0f)
+	{
+		if (!Refresh.IsValid())
+		{
+			// Whoever was throttling our content before has to leave it to us now
+			MarkThrottledBordersDirty();
+			Refresh = MakeUnique<FRefreshState>();
+			GExampleRefreshRateBorders.RemoveAllSwap([](const TWeakPtr<SExampleBorder>& Border) { return !Border.IsValid(); });
+			GExampleRefreshRateBorders.Add(SharedThis(this));
+
+			// Tick is where we find out its time to refresh, it gets called from our paint with the frame's time
+			// even while whatever's around us is cached
+			SetCanTick(true);
+		}
+		Refresh->RefreshRate = InRefreshRate;
+
+		// The whole point is reusing what our content drew last, which takes a retainer panel
+		SetRetainerPanelEnabled(true);
+		return;
+	}
+
+	// Our bound borders go back to checking their bindings every frame
+	for (const TWeakPtr<SExampleBorder>& Border : Refresh->ThrottledBorders)
+	{
+		if (const TSharedPtr<SExampleBorder> PinnedBorder = Border.Pin())
+		{
+			PinnedBorder->SetRefreshThrottled(false);
+		}
+	}
+
+	Refresh.Reset();
+	GExampleRefreshRateBorders.RemoveAllSwap([this](const TWeakPtr<SExampleBorder>& Border) { return !Border.IsValid() || Border.HasSameObject(this); });
+
+	// And whoever's above us with a refresh rate gets to throttle it instead
+	MarkThrottledBordersDirty();
+	SetCanTick(GetType() != SExampleBorderTypeName);
+	SetRetainerPanelEnabled(bWantsRetainContent);
+}
+
+float SExampleBorder::GetRefreshRate() const
+{
+	return Refresh.IsValid() ? Refresh->RefreshRate : 0.0f;
+}
+
+SExampleBorder::FRefreshStats SExampleBorder::GetRefreshStats() const
+{
+	FRefreshStats Stats;
+	if (Refresh.IsValid())
+	{
+		Stats.Refreshes = Refresh->NumRefreshes;
+		Stats.SkippedRefreshes = Refresh->NumSkippedRefreshes;
+		Stats.Lookups = Refresh->NumLookups;
+		Stats.ThrottledBorders = Refresh->ThrottledBorders.Num();
+	}
+	return Stats;
+}
+
+void SExampleBorder::ResetRefreshStats()
+{
+	if (Refresh.IsValid())
+	{
+		Refresh->NumRefreshes = 0;
+		Refresh->NumSkippedRefreshes = 0;
+		Refresh->NumLookups = 0;
+	}
+}
+
+void SExampleBorder::DumpRefreshRateStats(FOutputDevice& Ar, bool bReset)
+{
+	GExampleRefreshRateBorders.RemoveAllSwap([](const TWeakPtr<SExampleBorder>& Border) { return !Border.IsValid(); });
+
+	Ar.Logf(TEXT("%d borders with a refresh rate:"), GExampleRefreshRateBorders.Num());
+	for (const TWeakPtr<SExampleBorder>& WeakBorder : GExampleRefreshRateBorders)
+	{
+		const TSharedPtr<SExampleBorder> Border = WeakBorder.Pin();
+		const FRefreshStats Stats = Border->GetRefreshStats();
+		const uint32 Frames = Stats.Refreshes + Stats.SkippedRefreshes;
+		Ar.Logf(TEXT("  %s: %.1f Hz, %d bound borders throttled"), *FReflectionMetaData::GetWidgetDebugInfo(Border.Get()), Border->GetRefreshRate(), Stats.ThrottledBorders);
+		Ar.Logf(TEXT("    %u refreshes, %u refreshes skipped(%.1f%%), %u lookups of its bound borders"),
+			Stats.Refreshes, Stats.SkippedRefreshes, Frames > 0 ? 100.0 * Stats.SkippedRefreshes / Frames : 0.0, Stats.Lookups);
+
+		if (bReset)
+		{
+			Border->ResetRefreshStats();
+		}
+	}
+}
+
+void SExampleBorder::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	if (!Refresh.IsValid())
+	{
+		return;
+	}
+
+	if (InCurrentTime - Refresh->LastRefreshTime >= 1.0 / Refresh->RefreshRate)
+	{
+		Refresh->LastRefreshTime = InCurrentTime;
+		RefreshThrottledBorders();
+	}
+	else
+	{
+		// Every frame we don't refresh our bound borders just get copied over from last time
+		++Refresh->NumSkippedRefreshes;
+		FExampleUIStats::CountBorderSkippedRefresh();
+	}
+}
+
+void SExampleBorder::RefreshThrottledBorders()
+{
+	++Refresh->NumRefreshes;
+	FExampleUIStats::CountBorderRefresh();
+
+	// Walking our whole content is only worth it when it changed, otherwise the borders we found last time are still the ones
+	if (Refresh->bThrottledBordersDirty)
+	{
+		Refresh->bThrottledBordersDirty = false;
+		++Refresh->NumLookups;
+		FExampleUIStats::CountThrottledBorderRebuild();
+
+		const TArray<TWeakPtr<SExampleBorder>> PreviousBorders = MoveTemp(Refresh->ThrottledBorders);
+		Refresh->ThrottledBorders.Reset();
+
+		TSet<const SExampleBorder*> FoundBorders;
+		CollectThrottledBorders(GetContent(), FoundBorders);
+
+		// Whatever isn't in our content anymore(or isn't bound anymore) goes back to being volatile by itself
+		for (const TWeakPtr<SExampleBorder>& Border : PreviousBorders)
+		{
+			const TSharedPtr<SExampleBorder> PinnedBorder = Border.Pin();
+			if (PinnedBorder.IsValid() && !FoundBorders.Contains(PinnedBorder.Get()))
+			{
+				PinnedBorder->SetRefreshThrottled(false);
+			}
+		}
+	}
+
+	for (int32 Index = Refresh->ThrottledBorders.Num() - 1; Index >= 0; --Index)
+	{
+		const TSharedPtr<SExampleBorder> Border = Refresh->ThrottledBorders[Index].Pin();
+		if (!Border.IsValid())
+		{
+			Refresh->ThrottledBorders.RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		// Pick up what the bindings say now, padding and desired size scale change our layout on top of our paint
+		const bool bLayoutBound = Border->DesiredSizeScale.IsBound() || Border->ChildSlot.SlotPadding.IsBound();
+		Border->Invalidate(bLayoutBound ? EInvalidateWidgetReason::Layout : EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SExampleBorder::CollectThrottledBorders(const TSharedRef<SWidget>& InWidget, TSet<const SExampleBorder*>& OutFound)
+{
+	if (InWidget->GetType() == SExampleBorderTypeName)
+	{
+		const TSharedRef<SExampleBorder> Border = StaticCastSharedRef<SExampleBorder>(InWidget);
+
+		// It runs on its own schedule, and so does everything under it
+		if (Border->Refresh.IsValid())
+		{
+			return;
+		}
+
+		// Borders without bindings only ever change through their setters, which invalidate them straight away
+		if (Border->HasBoundAttributes())
+		{
+			Border->SetRefreshThrottled(true);
+			OutFound.Add(&Border.Get());
+			Refresh->ThrottledBorders.Add(Border);
+		}
+	}
+
+	FChildren* Children = InWidget->GetChildren();
+	for (int32 ChildIndex = 0; ChildIndex < Children->Num(); ++ChildIndex)
+	{
+		CollectThrottledBorders(Children->GetChildAt(ChildIndex), OutFound);
+	}
+}
+
+void SExampleBorder::MarkThrottledBordersDirty()
+{
+	if (Refresh.IsValid())
+	{
+		Refresh->bThrottledBordersDirty = true;
+		return;
+	}
+
+	// Otherwise its the first one above us, borders with a refresh rate stop looking at the first one they find
+	for (TSharedPtr<SWidget> Widget = GetParentWidget(); Widget.IsValid(); Widget = Widget->GetParentWidget())
+	{
+		if (Widget->GetType() == SExampleBorderTypeName)
+		{
+			SExampleBorder& Border = static_cast<SExampleBorder&>(*Widget);
+			if (Border.Refresh.IsValid())
+			{
+				Border.Refresh->bThrottledBordersDirty = true;
+				return;
+			}
+		}
+	}
+}
+
+void SExampleBorder::SetRefreshThrottled(bool bInRefreshThrottled)
+{
+	if (bRefreshThrottled != bInRefreshThrottled)
+	{
+		bRefreshThrottled = bInRefreshThrottled;
+		Invalidate(EInvalidateWidgetReason::Volatility);
+	}
+}
+
+void SExampleBorder::SetBorderBackgroundColor(const TAttribute<FSlateColor>& InColorAndOpacity)
+{
+	SetAttribute(BorderBackgroundColor, InColorAndOpacity, EInvalidateWidgetReason::Paint);
+}
+
+void SExampleBorder::SetDesiredSizeScale(const TAttribute<FVector2D>& InDesiredSizeScale)
+{
+	SetAttribute(DesiredSizeScale, InDesiredSizeScale, EInvalidateWidgetReason::Layout);
+}
+
+void SExampleBorder::SetHAlign(EHorizontalAlignment HAlign)
+{
+	if (ChildSlot.HAlignment != HAlign)
+	{
+		ChildSlot.HAlignment = HAlign;
+		// Moves our content around but can't change our desired size, so layout is as far as this has to go
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SExampleBorder::SetVAlign(EVerticalAlignment VAlign)
+{
+	if (ChildSlot.VAlignment != VAlign)
+	{
+		ChildSlot.VAlignment = VAlign;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SExampleBorder::SetPadding(const TAttribute<FMargin>& InPadding)
+{
+	SetAttribute(ChildSlot.SlotPadding, InPadding, EInvalidateWidgetReason::Layout);
+}
+
+void SExampleBorder::SetShowEffectWhenDisabled(const TAttribute<bool>& InShowEffectWhenDisabled)
+{
+	SetAttribute(ShowDisabledEffect, InShowEffectWhenDisabled, EInvalidateWidgetReason::Paint);
+}
+
+void SExampleBorder::SetBorderImage(const TAttribute<const FSlateBrush*>& InBorderImage)
+{
+	const EInvalidateWidgetReason InvalidateReason = AssignBorderImage(InBorderImage);
+	if (InvalidateReason != EInvalidateWidgetReason::None)
+	{
+		Invalidate(InvalidateReason);
+	}
+}
+
+void SExampleBorder::SetStyle(const TAttribute<const FSlateBrush*>& InBorderImage, const TAttribute<FSlateColor>& InBorderBackgroundColor, const TAttribute<FLinearColor>& InColorAndOpacity)
+{
+	// Everything gets assigned first and we invalidate once at the end, with whatever the changes add up to
+	EInvalidateWidgetReason InvalidateReason = AssignBorderImage(InBorderImage);
+
+	// If a color goes from being bound to a value(or the other way around) our volatility changes as well
+	if (BorderBackgroundColor.IsBound() != InBorderBackgroundColor.IsBound() || ColorAndOpacity.IsBound() != InColorAndOpacity.IsBound())
+	{
+		InvalidateReason |= EInvalidateWidgetReason::Paint | EInvalidateWidgetReason::Volatility;
+	}
+
+	// Restyling with the exact same colors(e.g. a theme that didn't touch our style) shouldn't cost a repaint.
+	// Set them directly instead of going through SetAttribute, which would invalidate us once per attribute
+	if (!BorderBackgroundColor.IdenticalTo(InBorderBackgroundColor) || !ColorAndOpacity.IdenticalTo(InColorAndOpacity))
+	{
+		BorderBackgroundColor = InBorderBackgroundColor;
+		ColorAndOpacity = InColorAndOpacity;
+
+		// Neither of these change our desired size so a repaint is all we need
+		InvalidateReason |= EInvalidateWidgetReason::Paint;
+	}
+
+	if (InvalidateReason != EInvalidateWidgetReason::None)
+	{
+		Invalidate(InvalidateReason);
+	}
+}
+
+EInvalidateWidgetReason SExampleBorder::AssignBorderImage(const TAttribute<const FSlateBrush*>& InBorderImage)
+{
+	// Going from a bound brush to a plain one(or the other way around) changes whether we're volatile
+	EInvalidateWidgetReason InvalidateReason = BorderImage.IsBound() != InBorderImage.IsBound()
+		? EInvalidateWidgetReason::Paint | EInvalidateWidgetReason::Volatility
+		: EInvalidateWidgetReason::None;
+
+	if (InBorderImage.IsBound())
+	{
+		// A bound brush gets asked for every time we paint, so there's nothing to compare but the binding itself
+		if (!BorderImage.IdenticalTo(InBorderImage))
+		{
+			InvalidateReason |= EInvalidateWidgetReason::Paint;
+		}
+		BorderImageContents.Reset();
+	}
+	else
+	{
+		// Compare the contents rather than the pointer, the same brush changed in place(UExampleBorder's own, before it's interned)
+		// needs a repaint, and a different brush that looks exactly the same doesn't.
+		// Our brush never changes our desired size, so a repaint is the most it ever takes
+		const FSlateBrush* NewBrush = InBorderImage.Get();
+		const bool bBrushChanged = NewBrush
+			? !BorderImageContents.IsSet() || !(BorderImageContents.GetValue() == *NewBrush)
+			: BorderImageContents.IsSet();
+		if (bBrushChanged)
+		{
+			BorderImageContents = NewBrush ? TOptional<FSlateBrush>(*NewBrush) : TOptional<FSlateBrush>();
+			InvalidateReason |= EInvalidateWidgetReason::Paint;
+		}
+	}
+
+	BorderImage = InBorderImage;
+	return InvalidateReason;
+}
+
+bool SExampleBorder::HasPointerEventHandler(FName EventName) const
+{
+	const FPointerEventHandler* Handler = GetPointerEvent(EventName);
+	return Handler && Handler->IsBound();
+}
+
+void SExampleBorder::SetInputStamp(uint64 InInputStamp)
+{
+	// Keep the latest stamp if we get changed multiple times before painting, that's the input we're about to show
+	if (InInputStamp > PendingInputStamp)
+	{
+		PendingInputStamp = InInputStamp;
+	}
+}
+
+int32 SExampleBorder::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
+	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
+	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	FExampleUIStats::CountBorderPaint();
+
+	// Get our brush
+	const FSlateBrush* BrushResource = BorderImage.Get();
+
+	// Check if this widget is enabled/disabled
+    const bool bEnabled = ShouldBeEnabled(bParentEnabled);
+
+	// Only draw the box if we're allowed to draw anything
+    if ( BrushResource && BrushResource->DrawAs != ESlateBrushDrawType::NoDrawType )
+    {
+    	// Get the disabled effect value
+    	const bool bShowDisabledEffect = ShowDisabledEffect.Get();
+    	// Figure our which effect to draw
+    	const ESlateDrawEffect DrawEffects = (bShowDisabledEffect && !bEnabled) ? ESlateDrawEffect::DisabledEffect : ESlateDrawEffect::None;
+    	// This creates a primitive box ontop of this widget
+    	MakeBorderBox(
+                   OutDrawElements,
+                   LayerId,
+                   AllottedGeometry.ToPaintGeometry(),
+                   BrushResource,
+                   DrawEffects,
+                   InWidgetStyle,
+                   BorderBackgroundColor.Get().GetColor(InWidgetStyle)
+               );
+    }
+
+	// If an input caused this paint then this is where its visual change actually shows up
+	if (PendingInputStamp != 0)
+	{
+		FExampleInputLatencyTracker::RecordPaint(PendingInputStamp);
+		PendingInputStamp = 0;
+	}
+
+   
+    return SCompoundWidget::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bEnabled );
+}
+
+void SExampleBorder::MakeBorderBox(FSlateWindowElementList& OutDrawElements, int32 LayerId, const FPaintGeometry& PaintGeometry,
+	const FSlateBrush* Brush, ESlateDrawEffect DrawEffects, const FWidgetStyle& InWidgetStyle, const FLinearColor& BackgroundColor)
+{
+	FSlateDrawElement::MakeBox(
+		OutDrawElements,
+		LayerId,
+		PaintGeometry,
+		Brush,
+		DrawEffects,
+		Brush->GetTint(InWidgetStyle) * InWidgetStyle.GetColorAndOpacityTint() * BackgroundColor
+	);
+}
+
+bool SExampleBorder::ComputeVolatility() const
+{
+	// Anything that's bound has to be checked every frame so with global invalidation we'd never see it change otherwise,
+	// unless a border above us with a refresh rate is taking care of that
+	return !bRefreshThrottled && HasBoundAttributes();
+}
+
+bool SExampleBorder::HasBoundAttributes() const
+{
+	// Check to make sure everything is properly bound to a value.
+	// That includes the attributes we inherit from our compound widget and our slot's padding
+	return BorderImage.IsBound()
+	|| BorderBackgroundColor.IsBound()
+	|| DesiredSizeScale.IsBound()
+	|| ShowDisabledEffect.IsBound()
+	|| ColorAndOpacity.IsBound()
+	|| ForegroundColor.IsBound()
+	|| ContentScale.IsBound()
+	|| ChildSlot.SlotPadding.IsBound();
+}
+
+FVector2D SExampleBorder::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	FExampleUIStats::CountBorderPrepass();
+
+	// If you're getting an error regarding the layout scale multiplier, thats because the parameter wasn't setup with a name initially in the .h of base class
+	return DesiredSizeScale.Get() * SCompoundWidget::ComputeDesiredSize(LayoutScaleMultiplier);
+}
+
+// This is the end of that newer macro at the top of the page
+END_SLATE_FUNCTION_BUILD_OPTIMIZATION
@@ -0,0 +1,259 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Layout/PaintGeometry.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/SNullWidget.h"
+
+class SInvalidationPanel;
+
+/**
+ * 
+ */
+class NICKSEXAMPLEPROJECTUI_API SExampleBorder : public SCompoundWidget
+{
+public:
+
+	// These are basically constructor parameters for SExampleBorder when calling SNew on them
+	// This also allows for us to do bindings as well within SNew
+	SLATE_BEGIN_ARGS(SExampleBorder)
+		: _HAlign( HAlign_Fill )
+    	, _VAlign( VAlign_Fill )
+    	, _Padding( FMargin(2.0f) )
+		, _BorderImage( FCoreStyle::Get().GetBrush( "Border" ) )
+        , _ContentScale( FVector2D(1,1) )
+        , _DesiredSizeScale( FVector2D(1,1) )
+		, _ShowEffectWhenDisabled( true )
+		, _ColorAndOpacity( FLinearColor(1,1,1,1) )
+		, _BorderBackgroundColor( FLinearColor::White )
+		, _ForegroundColor( FSlateColor::UseForeground() )
+		, _RetainContent( false )
+		, _RefreshRate( 0.0f )
+		{ }
+
+	// Declaring the widget argument to add to this class's child slot
+	SLATE_DEFAULT_SLOT( FArguments, Content )
+
+	// Overriding parent argument's and attributes
+	SLATE_ARGUMENT( EHorizontalAlignment, HAlign )
+    SLATE_ARGUMENT( EVerticalAlignment, VAlign )
+    SLATE_ATTRIBUTE( FMargin, Padding )
+
+	SLATE_EVENT( FPointerEventHandler, OnMouseButtonDown )
+    SLATE_EVENT( FPointerEventHandler, OnMouseButtonUp )
+    SLATE_EVENT( FPointerEventHandler, OnMouseMove )
+    SLATE_EVENT( FPointerEventHandler, OnMouseDoubleClick )
+	
+	SLATE_ATTRIBUTE(const FSlateBrush*, BorderImage)
+	SLATE_ATTRIBUTE( FVector2D, ContentScale )
+	SLATE_ATTRIBUTE( FVector2D, DesiredSizeScale )	
+	/** Whether or not to show the disabled effect when this border is disabled */
+	SLATE_ATTRIBUTE( bool, ShowEffectWhenDisabled )
+	
+	/** ColorAndOpacity is the color and opacity of content in the border */
+    SLATE_ATTRIBUTE( FLinearColor, ColorAndOpacity )
+    /** BorderBackgroundColor refers to the actual color and opacity of the supplied border image.*/
+    SLATE_ATTRIBUTE( FSlateColor, BorderBackgroundColor )
+    /** The foreground color of text and some glyphs that appear as the border's content. */
+    SLATE_ATTRIBUTE( FSlateColor, ForegroundColor )
+	/** Whether or not to keep the draw elements our content made and reuse them until something inside it changes, see SetRetainContent */
+	SLATE_ARGUMENT( bool, RetainContent )
+	/** How many times a second the bound borders in our content get refreshed, 0 refreshes them every frame like normal, see SetRefreshRate */
+	SLATE_ARGUMENT( float, RefreshRate )
+	
+	SLATE_END_ARGS()
+
+	/** Constructs this widget with InArgs from the SLATE_BEGIN_ARGS/SLATE_END_ARGS parameters */
+	void Construct(const FArguments& InArgs);
+
+	virtual ~SExampleBorder();
+
+	/**
+	* Sets the content for this border
+	*
+	* @param	InContent	The widget to use as content for the border
+	*/
+	virtual void SetContent( TSharedRef< SWidget > InContent );
+
+	/**
+	* Gets the content for this border
+	*
+	* @return The widget used as content for the border
+	*/
+	const TSharedRef< SWidget >& GetContent() const;
+
+	/** Clears out the content for the border */
+	void ClearContent();
+	
+	/** Sets the color and opacity of the background image of this border. */
+    void SetBorderBackgroundColor(const TAttribute<FSlateColor>& InColorAndOpacity);
+   
+    /** Set the desired size scale multiplier */
+    void SetDesiredSizeScale(const TAttribute<FVector2D>& InDesiredSizeScale);
+    
+    /** See HAlign argument */
+    void SetHAlign(EHorizontalAlignment HAlign);
+   
+    /** See VAlign argument */
+    void SetVAlign(EVerticalAlignment VAlign);
+   
+    /** See Padding attribute */
+    void SetPadding(const TAttribute<FMargin>& InPadding);
+   
+    /** See ShowEffectWhenDisabled attribute */
+    void SetShowEffectWhenDisabled(const TAttribute<bool>& InShowEffectWhenDisabled);
+   
+    /** See BorderImage attribute, repaints us if the brush changed, even if it's the same brush changed in place */
+    void SetBorderImage(const TAttribute<const FSlateBrush*>& InBorderImage);
+
+	/**
+	 * Sets the brush, its color and the content color all at once with a single invalidation,
+	 * this is what style/theme changes use so that restyling a border only costs one repaint.
+	 */
+	void SetStyle(const TAttribute<const FSlateBrush*>& InBorderImage, const TAttribute<FSlateColor>& InBorderBackgroundColor, const TAttribute<FLinearColor>& InColorAndOpacity);
+
+	/**
+	 * Turns retained mode on or off. When it's on our content sits inside an invalidation panel of our own, so the draw elements
+	 * our whole content made get recorded the first time and just get copied over again every frame after that,
+	 * without painting(or even visiting) any of the widgets inside. Anything inside that invalidates itself gets repainted
+	 * on its own and volatile widgets still paint every frame. It doesn't need global invalidation to be on, which is the point.
+	 * Great for big static subtrees, useless for content that changes every frame(that just adds the recording on top).
+	 * Having a refresh rate keeps it on no matter what this says.
+	 */
+	void SetRetainContent(bool bInRetainContent);
+	bool IsRetainingContent() const { return RetainerPanel.IsValid(); }
+
+	/**
+	 * Refreshes our content at a lower rate than the game runs at. Our content gets retained(see SetRetainContent), and every
+	 * SExampleBorder inside of it that has something bound stops being volatile, so instead of calling its bindings and
+	 * repainting every frame it keeps reusing what it drew last. Then InRefreshRate times a second we invalidate those borders
+	 * so they pick up whatever their bindings say now. Anything that changes through a setter still shows up right away,
+	 * it's only bindings that lag behind. Meant for HUD frames bound to values that barely change, at 144Hz with a
+	 * refresh rate of 10 that's 14 out of every 15 frames where none of them get visited. 0 turns it off.
+	 * Borders that have a refresh rate of their own look after their own content.
+	 * Which borders those are only gets looked up again when content changes through an SExampleBorder in here(or one
+	 * gets or loses a refresh rate), a panel in between getting new children doesn't tell us. Borders we missed that way
+	 * just keep being volatile by themselves until the next time.
+	 */
+	void SetRefreshRate(float InRefreshRate);
+	float GetRefreshRate() const;
+
+	/** How a border with a refresh rate has been doing since it got its refresh rate(or since ResetRefreshStats) */
+	struct FRefreshStats
+	{
+		/** Frames where we had our bound borders pick up their bindings */
+		uint32 Refreshes = 0;
+
+		/** Frames where we left them with what they drew last */
+		uint32 SkippedRefreshes = 0;
+
+		/** Refreshes that had to walk our content to find the bound borders again, because it changed */
+		uint32 Lookups = 0;
+
+		/** How many bound borders we're throttling right now */
+		int32 ThrottledBorders = 0;
+	};
+
+	/** Our refresh stats, all zeros if we don't have a refresh rate */
+	FRefreshStats GetRefreshStats() const;
+	void ResetRefreshStats();
+
+	/** Prints the refresh stats of every border that currently has a refresh rate, see "ExampleUI.RefreshRate.Stats" */
+	static void DumpRefreshRateStats(FOutputDevice& Ar, bool bReset);
+
+	/** Hands this border an input stamp(see FExampleInputLatencyTracker) that gets reported the next time we paint */
+	void SetInputStamp(uint64 InInputStamp);
+
+	/**
+	 * Draws the box a border draws behind its content, the brush's tint and the widget style's tint on top of the background color.
+	 * Anything that wants to look exactly like a border without being one(see SExampleNameplateLayer) draws it with this.
+	 */
+	static void MakeBorderBox(FSlateWindowElementList& OutDrawElements, int32 LayerId, const FPaintGeometry& PaintGeometry,
+		const FSlateBrush* Brush, ESlateDrawEffect DrawEffects, const FWidgetStyle& InWidgetStyle, const FLinearColor& BackgroundColor);
+
+	/** Whether or not a handler is bound for the given pointer event(SWidget's names for them, "MouseButtonDown"...etc), binds nothing itself */
+	bool HasPointerEventHandler(FName EventName) const;
+
+	// SWidget interface
+	virtual int32 OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const override;
+	virtual bool ComputeVolatility() const override;
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	// End of SWidget interface
+	
+protected:
+
+	// Begin SWidget overrides.
+	virtual FVector2D ComputeDesiredSize(float) const override;
+	// End SWidget overrides.
+	
+	// Our brush. We keep track of its contents ourselves(see BorderImageContents) instead of using FInvalidatableBrushAttribute,
+	// whose setter invalidates us on its own(sometimes for layout) before we know what else is changing along with it
+	TAttribute<const FSlateBrush*> BorderImage;
+
+	/** A copy of our brush as it was when it was set(unset while it's bound), so the same brush changed in place still counts as a change */
+	TOptional<FSlateBrush> BorderImageContents;
+	
+	TAttribute<FSlateColor> BorderBackgroundColor;
+	TAttribute<FVector2D> DesiredSizeScale;
+	
+	/** Whether or not to show the disabled effect when this border is disabled */
+	TAttribute<bool> ShowDisabledEffect;
+
+	/** Whether any of our attributes are bound(and get checked every frame unless we're throttled by a refresh rate) */
+	bool HasBoundAttributes() const;
+
+	/** Sets our brush without invalidating us, returns the cheapest reason that covers the change(None if nothing changed) */
+	EInvalidateWidgetReason AssignBorderImage(const TAttribute<const FSlateBrush*>& InBorderImage);
+
+	/** Puts our content in our retainer panel or takes it back out */
+	void SetRetainerPanelEnabled(bool bEnabled);
+
+	/** Has every bound border in our content pick up its bindings again, looking up which ones those are first if our content changed */
+	void RefreshThrottledBorders();
+
+	/** Adds the bound borders in and under InWidget to our refresh state, stopping at borders with their own refresh rate */
+	void CollectThrottledBorders(const TSharedRef<SWidget>& InWidget, TSet<const SExampleBorder*>& OutFound);
+
+	/** Lets the border with a refresh rate that looks after us(which could be us) know it has to look up its bound borders again */
+	void MarkThrottledBordersDirty();
+
+	/** Stops(or starts) us being volatile because of our bindings, see SetRefreshRate */
+	void SetRefreshThrottled(bool bInRefreshThrottled);
+
+	/** Our content's invalidation panel while we're retaining it, this is what actually sits in our child slot then */
+	TSharedPtr<SInvalidationPanel> RetainerPanel;
+
+	/** Our actual content while we're retaining it, since our child slot has the panel instead */
+	TSharedRef<SWidget> RetainedContent = SNullWidget::NullWidget;
+
+	/** The latest input stamp that caused a change we haven't painted yet, mutable since its consumed in OnPaint */
+	mutable uint64 PendingInputStamp = 0;
+
+	/** Everything a border with a refresh rate keeps track of, most borders never have one so it's only allocated when needed */
+	struct FRefreshState
+	{
+		float RefreshRate = 0.0f;
+		double LastRefreshTime = TNumericLimits<double>::Lowest();
+
+		/** The bound borders in our content as of the last time we looked, they're the ones that aren't volatile because of us */
+		TArray<TWeakPtr<SExampleBorder>> ThrottledBorders;
+
+		/** Set when our content changed since we last looked, see MarkThrottledBordersDirty */
+		bool bThrottledBordersDirty = true;
+
+		uint32 NumRefreshes = 0;
+		uint32 NumSkippedRefreshes = 0;
+		uint32 NumLookups = 0;
+	};
+	TUniquePtr<FRefreshState> Refresh;
+
+	/** Whether or not SetRetainContent asked for retaining, since a refresh rate retains either way */
+	bool bWantsRetainContent = false;
+
+	/** Set while a border above us with a refresh rate is the one deciding when we pick up our bindings */
+	bool bRefreshThrottled = false;
+	
+};
@@ -0,0 +1,312 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SExampleBorderGrid.h"
+#include "Layout/ArrangedChildren.h"
+
+/** Lets slate's hit test grid ask a grid for the rest of the widget path under the cursor, see SExampleBorderGrid::FindPathAt */
+class SExampleBorderGrid::FHitTestPath : public ICustomHitTestPath
+{
+public:
+
+	FHitTestPath(const TSharedRef<const SExampleBorderGrid>& InGrid)
+		: Grid(InGrid)
+	{
+	}
+
+	virtual TArray<FWidgetAndPointer> GetBubblePathAndVirtualCursors(const FGeometry& InGeometry, FVector2D DesktopSpaceCoordinate, bool bIgnoreEnabledStatus) const override
+	{
+		const TSharedPtr<const SExampleBorderGrid> GridPtr = Grid.Pin();
+		return GridPtr.IsValid() ? GridPtr->FindPathAt(DesktopSpaceCoordinate, bIgnoreEnabledStatus) : TArray<FWidgetAndPointer>();
+	}
+
+	virtual void ArrangeCustomHitTestChildren(FArrangedChildren& ArrangedChildren) const override
+	{
+		if (const TSharedPtr<const SExampleBorderGrid> GridPtr = Grid.Pin())
+		{
+			GridPtr->ArrangeChildren(GridPtr->GetPaintSpaceGeometry(), ArrangedChildren);
+		}
+	}
+
+	virtual TOptional<FVirtualPointerPosition> TranslateMouseCoordinateForCustomHitTestChild(const TSharedRef<SWidget>& ChildWidget, const FGeometry& MyGeometry,
+		const FVector2D& ScreenSpaceMouseCoordinate, const FVector2D& LastScreenSpaceMouseCoordinate) const override
+	{
+		// Our children are in the same space we are, there's nothing to translate
+		return TOptional<FVirtualPointerPosition>();
+	}
+
+private:
+
+	TWeakPtr<const SExampleBorderGrid> Grid;
+};
+
+SExampleBorderGrid::SExampleBorderGrid()
+	: Children(this)
+{
+	SetCanTick(false);
+	bCanSupportFocus = false;
+}
+
+void SExampleBorderGrid::Construct(const FArguments& InArgs)
+{
+	Columns = FMath::Max(InArgs._Columns, 1);
+	CellPadding = InArgs._CellPadding;
+	bCompactLayers = InArgs._CompactLayers;
+	bUseHitTestIndex = InArgs._UseHitTestIndex;
+
+	// We're the one slate hit tests when we're looking after our children's hit testing
+	if (bUseHitTestIndex)
+	{
+		SetVisibility(EVisibility::Visible);
+		HitTestPath = MakeShared<FHitTestPath>(SharedThis(this));
+	}
+
+	// Take ownership of every slot that was declared inline
+	for (int32 SlotIndex = 0; SlotIndex < InArgs.Slots.Num(); ++SlotIndex)
+	{
+		Children.Add(InArgs.Slots[SlotIndex]);
+	}
+}
+
+SExampleBorderGrid::FSlot& SExampleBorderGrid::AddSlot()
+{
+	FSlot& NewSlot = *(new FSlot());
+	Children.Add(&NewSlot);
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+	return NewSlot;
+}
+
+void SExampleBorderGrid::ClearChildren()
+{
+	if (Children.Num() > 0)
+	{
+		Children.Empty();
+		Invalidate(EInvalidateWidgetReason::ChildOrder);
+	}
+
+	HitTestIndex.Reset();
+	ChildGeometries.Reset();
+}
+
+void SExampleBorderGrid::SetColumns(int32 InColumns)
+{
+	InColumns = FMath::Max(InColumns, 1);
+	if (Columns != InColumns)
+	{
+		Columns = InColumns;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SExampleBorderGrid::SetCellPadding(const FMargin& InCellPadding)
+{
+	if (CellPadding != InCellPadding)
+	{
+		CellPadding = InCellPadding;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SExampleBorderGrid::SetCompactLayers(bool bInCompactLayers)
+{
+	// Only which layers things are painted on changes, nothing moves
+	if (bCompactLayers != bInCompactLayers)
+	{
+		bCompactLayers = bInCompactLayers;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+FIntPoint SExampleBorderGrid::GetGridSize() const
+{
+	const int32 NumColumns = FMath::Max(FMath::Min(Columns, Children.Num()), 1);
+	const int32 NumRows = FMath::Max(FMath::DivideAndRoundUp(Children.Num(), Columns), 1);
+	return FIntPoint(NumColumns, NumRows);
+}
+
+void SExampleBorderGrid::GetCellRect(const FGeometry& AllottedGeometry, int32 ChildIndex, FVector2D& OutPosition, FVector2D& OutSize) const
+{
+	const FIntPoint GridSize = GetGridSize();
+	OutSize = AllottedGeometry.GetLocalSize() / FVector2D(GridSize);
+	OutPosition = FVector2D(ChildIndex % Columns, ChildIndex / Columns) * OutSize;
+}
+
+FGeometry SExampleBorderGrid::MakeChildGeometry(const FGeometry& AllottedGeometry, int32 ChildIndex) const
+{
+	FVector2D CellPosition;
+	FVector2D CellSize;
+	GetCellRect(AllottedGeometry, ChildIndex, CellPosition, CellSize);
+
+	return AllottedGeometry.MakeChild(
+		Children[ChildIndex].GetWidget(),
+		CellPosition + CellPadding.GetTopLeft(),
+		FVector2D::Max(CellSize - CellPadding.GetDesiredSize(), FVector2D::ZeroVector)
+	);
+}
+
+void SExampleBorderGrid::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+{
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+	{
+		const TSharedRef<SWidget>& Widget = Children[ChildIndex].GetWidget();
+		const EVisibility ChildVisibility = Widget->GetVisibility();
+
+		// Collapsed children still keep their cell, so everything else stays where it is
+		if (ArrangedChildren.Accepts(ChildVisibility))
+		{
+			ArrangedChildren.AddWidget(ChildVisibility, MakeChildGeometry(AllottedGeometry, ChildIndex));
+		}
+	}
+}
+
+int32 SExampleBorderGrid::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	FPaintArgs NewArgs = Args.WithNewParent(this);
+	const bool bShouldBeEnabled = ShouldBeEnabled(bParentEnabled);
+
+	// Keep our children out of slate's hit test grid, we find them ourselves and give slate the rest of the path when it finds us
+	if (bUseHitTestIndex)
+	{
+		NewArgs.SetInheritedHittestability(false);
+		ChildGeometries.SetNum(Children.Num());
+		Args.GetHittestGrid().InsertCustomHitTestPath(ConstCastSharedRef<SExampleBorderGrid>(SharedThis(this)), HitTestPath.ToSharedRef());
+	}
+
+	// The highest layer anything has painted on so far
+	int32 MaxLayerId = LayerId;
+	// Where children that stay inside their cells start painting when we're compacting
+	int32 SharedLayerId = LayerId;
+
+	// We go through our children ourselves rather than arranging them first, since we need to know which cell each one is in
+	bool bPaintedAnything = false;
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+	{
+		const TSharedRef<SWidget>& Widget = Children[ChildIndex].GetWidget();
+		const EVisibility ChildVisibility = Widget->GetVisibility();
+		if (!ChildVisibility.IsVisible())
+		{
+			HitTestIndex.Remove(ChildIndex);
+			continue;
+		}
+
+		const FArrangedWidget CurWidget(Widget, MakeChildGeometry(AllottedGeometry, ChildIndex));
+		if (IsChildWidgetCulled(MyCullingRect, CurWidget))
+		{
+			HitTestIndex.Remove(ChildIndex);
+			continue;
+		}
+
+		// This only does any work if the child moved since last time
+		if (bUseHitTestIndex)
+		{
+			ChildGeometries[ChildIndex] = CurWidget.Geometry;
+			if (ChildVisibility.IsHitTestVisible())
+			{
+				HitTestIndex.Update(ChildIndex, CurWidget.Geometry.GetRenderBoundingRect());
+			}
+			else
+			{
+				HitTestIndex.Remove(ChildIndex);
+			}
+		}
+
+		bool bStaysInCell = false;
+		if (bCompactLayers)
+		{
+			// Cells never overlap, so a child that stays inside its cell can't overlap any of its siblings either
+			FVector2D CellPosition;
+			FVector2D CellSize;
+			GetCellRect(AllottedGeometry, ChildIndex, CellPosition, CellSize);
+
+			const FSlateRect CellRect = AllottedGeometry.MakeChild(CellPosition, CellSize).GetRenderBoundingRect();
+			const FSlateRect ChildRect = CurWidget.Geometry.GetRenderBoundingRect();
+			const float Tolerance = 0.5f;
+			bStaysInCell = ChildRect.Left >= CellRect.Left - Tolerance && ChildRect.Top >= CellRect.Top - Tolerance
+				&& ChildRect.Right <= CellRect.Right + Tolerance && ChildRect.Bottom <= CellRect.Bottom + Tolerance;
+		}
+
+		// Without compaction every child goes on top of the one before it, like an overlay or canvas panel would
+		const int32 ChildLayerId = bStaysInCell ? SharedLayerId : (bPaintedAnything ? MaxLayerId + 1 : LayerId);
+		const int32 ChildMaxLayerId = Widget->Paint(NewArgs, CurWidget.Geometry, MyCullingRect, OutDrawElements, ChildLayerId, InWidgetStyle, bShouldBeEnabled);
+		MaxLayerId = FMath::Max(MaxLayerId, ChildMaxLayerId);
+		bPaintedAnything = true;
+
+		// Anything that reached outside its cell may overlap its siblings, so everything after it has to go on top
+		if (bCompactLayers && !bStaysInCell)
+		{
+			SharedLayerId = MaxLayerId + 1;
+		}
+	}
+
+	return MaxLayerId;
+}
+
+FVector2D SExampleBorderGrid::ComputeDesiredSize(float) const
+{
+	// Every cell is as big as our biggest child wants to be
+	FVector2D MaxChildDesiredSize = FVector2D::ZeroVector;
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+	{
+		const TSharedRef<SWidget>& Widget = Children[ChildIndex].GetWidget();
+		if (Widget->GetVisibility() != EVisibility::Collapsed)
+		{
+			MaxChildDesiredSize = FVector2D::Max(MaxChildDesiredSize, Widget->GetDesiredSize() + CellPadding.GetDesiredSize());
+		}
+	}
+
+	return MaxChildDesiredSize * FVector2D(GetGridSize());
+}
+
+int32 SExampleBorderGrid::FindChildIndexAt(const FVector2D& InAbsolutePosition) const
+{
+	const int32 ChildIndex = bUseHitTestIndex ? HitTestIndex.FindAt(InAbsolutePosition) : INDEX_NONE;
+	return Children.IsValidIndex(ChildIndex) && ChildGeometries.IsValidIndex(ChildIndex) ? ChildIndex : INDEX_NONE;
+}
+
+TArray<FWidgetAndPointer> SExampleBorderGrid::FindPathAt(const FVector2D& InAbsolutePosition, bool bIgnoreEnabledStatus) const
+{
+	TArray<FWidgetAndPointer> Path;
+	const int32 ChildIndex = FindChildIndexAt(InAbsolutePosition);
+	if (ChildIndex == INDEX_NONE)
+	{
+		return Path;
+	}
+
+	// Walk down from the child's cell the way slate's hit test grid would have found things, the last widget arranged is the one on top
+	FArrangedWidget Current(Children[ChildIndex].GetWidget(), ChildGeometries[ChildIndex]);
+	int32 LeafPathLength = 0;
+	while (bIgnoreEnabledStatus || Current.Widget->IsEnabled())
+	{
+		const EVisibility CurrentVisibility = Current.Widget->GetVisibility();
+		Path.Add(FWidgetAndPointer(Current, nullptr));
+		if (CurrentVisibility.IsHitTestVisible())
+		{
+			LeafPathLength = Path.Num();
+		}
+
+		if (!CurrentVisibility.AreChildrenHitTestVisible())
+		{
+			break;
+		}
+
+		FArrangedChildren ArrangedChildren(EVisibility::Visible);
+		Current.Widget->ArrangeChildren(Current.Geometry, ArrangedChildren);
+
+		int32 HitIndex = ArrangedChildren.Num() - 1;
+		while (HitIndex >= 0 && !ArrangedChildren[HitIndex].Geometry.IsUnderLocation(InAbsolutePosition))
+		{
+			--HitIndex;
+		}
+
+		if (HitIndex == INDEX_NONE)
+		{
+			break;
+		}
+		Current = ArrangedChildren[HitIndex];
+	}
+
+	// Slate's paths end at the widget on top that's hit testable, anything we walked through below that doesn't get events
+	Path.RemoveAt(LeafPathLength, Path.Num() - LeafPathLength);
+	return Path;
+}
@@ -0,0 +1,132 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SPanel.h"
+#include "Input/HittestGrid.h"
+#include "Layout/Children.h"
+#include "SlotBase.h"
+#include "ExampleSpatialHitIndex.h"
+
+/**
+ * A panel that lays its children(usually SExampleBorders) out in equally sized cells, filling rows left to right.
+ *
+ * Panels like overlays and canvases paint every child on a layer above the one before it, which means identical border boxes
+ * can never be batched together. With CompactLayers on, every child that stays inside its own cell is painted starting
+ * at the same layer, since cells don't overlap the paint order between them doesn't matter and their boxes can share batches.
+ * A child that reaches outside its cell(e.g. through a render transform) goes on top of everything painted before it, like it would without compaction.
+ * Note: children whose content paints outside their geometry without being clipped should turn compaction off.
+ *
+ * With UseHitTestIndex on our children aren't added to slate's hit test grid at all, we're hit testable ourselves and keep an
+ * FExampleSpatialHitIndex of where each child was painted. When slate finds us under the cursor it asks us(through a custom hit test path,
+ * like viewports use) for the rest of the path, we find the cell with the index and walk down into it to whatever's on top under the cursor.
+ * Finding the cell takes about the same time no matter how many children there are, and since slate gets the full widget path
+ * everything it does with one(bubbling events, mouse capture, enter/leave, cursors, tooltips) works like it would without the index.
+ */
+class NICKSEXAMPLEPROJECTUI_API SExampleBorderGrid : public SPanel
+{
+public:
+
+	/** Our slots don't need anything but their widget, their cell comes from their index */
+	class FSlot : public TSlotBase<FSlot>
+	{
+	public:
+		FSlot() : TSlotBase<FSlot>() {}
+	};
+
+	SLATE_BEGIN_ARGS(SExampleBorderGrid)
+		: _Columns( 1 )
+		, _CellPadding( FMargin(0.0f) )
+		, _CompactLayers( true )
+		, _UseHitTestIndex( false )
+		{
+			_Visibility = EVisibility::SelfHitTestInvisible;
+		}
+
+		SLATE_SUPPORTS_SLOT( SExampleBorderGrid::FSlot )
+
+		/** How many cells there are in a row */
+		SLATE_ARGUMENT( int32, Columns )
+		/** Space around each child inside of its cell */
+		SLATE_ARGUMENT( FMargin, CellPadding )
+		/** Whether or not children that stay inside their cells share layers, see the class comment */
+		SLATE_ARGUMENT( bool, CompactLayers )
+		/** Whether or not we find the child under the cursor ourselves, see the class comment */
+		SLATE_ARGUMENT( bool, UseHitTestIndex )
+
+	SLATE_END_ARGS()
+
+	SExampleBorderGrid();
+
+	/** Constructs this widget with InArgs from the SLATE_BEGIN_ARGS/SLATE_END_ARGS parameters */
+	void Construct(const FArguments& InArgs);
+
+	/** Used with SNew to declare slots inline */
+	static FSlot& Slot() { return *(new FSlot()); }
+
+	/** Adds a new child in the next free cell */
+	FSlot& AddSlot();
+
+	/** Removes every child */
+	void ClearChildren();
+
+	void SetColumns(int32 InColumns);
+	void SetCellPadding(const FMargin& InCellPadding);
+	void SetCompactLayers(bool bInCompactLayers);
+	bool GetCompactLayers() const { return bCompactLayers; }
+
+	/** The index of the child painted at the given absolute position, only works with UseHitTestIndex on */
+	int32 FindChildIndexAt(const FVector2D& InAbsolutePosition) const;
+
+	/**
+	 * The path from the child painted at the given absolute position down to the widget on top under it that's hit testable,
+	 * empty if there isn't one. This is what we hand slate to route pointer events with, only works with UseHitTestIndex on
+	 */
+	TArray<FWidgetAndPointer> FindPathAt(const FVector2D& InAbsolutePosition, bool bIgnoreEnabledStatus) const;
+
+	/** The hit index itself, for stats */
+	const FExampleSpatialHitIndex& GetHitTestIndex() const { return HitTestIndex; }
+
+	// SWidget interface
+	virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FChildren* GetChildren() override { return &Children; }
+	// End of SWidget interface
+
+protected:
+
+	// Begin SWidget overrides.
+	virtual FVector2D ComputeDesiredSize(float) const override;
+	// End SWidget overrides.
+
+	/** How many columns and rows we have for our current children */
+	FIntPoint GetGridSize() const;
+
+	/** The local position and size of the cell for the child at the given index */
+	void GetCellRect(const FGeometry& AllottedGeometry, int32 ChildIndex, FVector2D& OutPosition, FVector2D& OutSize) const;
+
+	/** The geometry of the child at the given index, its cell minus the padding */
+	FGeometry MakeChildGeometry(const FGeometry& AllottedGeometry, int32 ChildIndex) const;
+
+	TPanelChildren<FSlot> Children;
+
+	/** Hands slate the path below us with FindPathAt, defined in the .cpp */
+	class FHitTestPath;
+
+	/** Registered with the hit test grid every time we're painted, only exists with UseHitTestIndex on */
+	TSharedPtr<FHitTestPath> HitTestPath;
+
+	/** Where each child was last painted, kept up to date while painting so it only changes when our layout does */
+	mutable FExampleSpatialHitIndex HitTestIndex;
+
+	/** The geometry each child was last painted with, so we can hand it to them with their events */
+	mutable TArray<FGeometry> ChildGeometries;
+
+	bool bUseHitTestIndex = false;
+
+	int32 Columns = 1;
+	FMargin CellPadding;
+	bool bCompactLayers = true;
+};
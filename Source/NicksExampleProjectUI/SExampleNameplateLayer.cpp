@@ -0,0 +1,70 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SExampleNameplateLayer.h"
+#include "ExampleNameplateSubsystem.h"
+#include "ExampleUIStats.h"
+#include "SExampleBorder.h"
+
+DECLARE_CYCLE_STAT(TEXT("Nameplate Paint"), STAT_ExampleNameplatePaint, STATGROUP_ExampleUI);
+
+void SExampleNameplateLayer::Construct(const FArguments& InArgs, UExampleNameplateSubsystem* InSubsystem)
+{
+	Subsystem = InSubsystem;
+
+	// Nothing to tick, the subsystem does all of the per frame work before we paint
+	SetCanTick(false);
+}
+
+int32 SExampleNameplateLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
+	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
+	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_ExampleNameplatePaint);
+
+	const UExampleNameplateSubsystem* Nameplates = Subsystem.Get();
+	if (!Nameplates || Nameplates->GetDrawData().Num() == 0)
+	{
+		return LayerId;
+	}
+
+	const FSlateBrush* Brush = Nameplates->GetBrush();
+	const FSlateFontInfo& Font = Nameplates->GetFont();
+	const FVector2D Padding = Nameplates->GetPadding();
+	const FLinearColor TextColor = InWidgetStyle.GetColorAndOpacityTint() * Nameplates->GetTextColor();
+
+	// Screen positions are in viewport pixels, our geometry's scale is the DPI scale that turns our slate units into those
+	const float InverseScale = 1.0f / AllottedGeometry.Scale;
+
+	const int32 TextLayerId = LayerId + 1;
+	for (const FExampleNameplateDrawData& Nameplate : Nameplates->GetDrawData())
+	{
+		const FVector2D PlateSize = Nameplate.TextSize + Padding * 2.0f;
+
+		// The nameplate sits centered just above its screen position
+		const FVector2D TopLeft = Nameplate.ScreenPosition * InverseScale - FVector2D(PlateSize.X * 0.5f, PlateSize.Y) * Nameplate.Scale;
+
+		// Exactly the box an SExampleBorder with the nameplate style would draw
+		SExampleBorder::MakeBorderBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(PlateSize, FSlateLayoutTransform(Nameplate.Scale, TopLeft)),
+			Brush,
+			ESlateDrawEffect::None,
+			InWidgetStyle,
+			Nameplates->GetBrushColor() * Nameplate.Tint
+		);
+
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			TextLayerId,
+			AllottedGeometry.ToPaintGeometry(Nameplate.TextSize, FSlateLayoutTransform(Nameplate.Scale, TopLeft + Padding * Nameplate.Scale)),
+			Nameplate.Text,
+			Font,
+			ESlateDrawEffect::None,
+			TextColor * Nameplate.Tint
+		);
+	}
+
+	return TextLayerId;
+}
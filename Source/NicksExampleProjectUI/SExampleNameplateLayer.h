@@ -0,0 +1,46 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class UExampleNameplateSubsystem;
+
+/**
+ * The one widget every nameplate gets drawn by, see UExampleNameplateSubsystem. It covers the whole viewport and
+ * draws each nameplate like an SExampleBorder would(the box comes from SExampleBorder::MakeBorderBox, with the text inside),
+ * just without a widget per nameplate. A widget each would mean a prepass, arrange and paint per nameplate every frame, and their
+ * boxes and text interleaving layer by layer, see "ExampleUI.Bench.Nameplates" for what that costs.
+ *
+ * All of the boxes go on one layer and all of the text on the one above, which is what lets slate batch every nameplate's box
+ * together and every nameplate's text together. The catch is that the text of a nameplate further away can show through the box
+ * of an overlapping one that's closer, which for nameplates is a trade well worth making.
+ */
+class NICKSEXAMPLEPROJECTUI_API SExampleNameplateLayer : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SExampleNameplateLayer)
+		{
+			_Visibility = EVisibility::HitTestInvisible;
+		}
+	SLATE_END_ARGS()
+
+	/** Constructs this widget with InArgs, drawing the nameplates of the given subsystem */
+	void Construct(const FArguments& InArgs, UExampleNameplateSubsystem* InSubsystem);
+
+	// SWidget interface
+	virtual int32 OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const override;
+	virtual bool ComputeVolatility() const override { return true; }
+	// End of SWidget interface
+
+protected:
+
+	// Begin SWidget overrides.
+	virtual FVector2D ComputeDesiredSize(float) const override { return FVector2D::ZeroVector; }
+	// End SWidget overrides.
+
+	TWeakObjectPtr<UExampleNameplateSubsystem> Subsystem;
+};